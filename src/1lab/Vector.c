@@ -2,6 +2,8 @@
 // PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
 
 #include "Vector.h"
+#include "VectorArena.h"
+#include "VectorStats.h"
 
 /// [url] https://en.cppreference.com/w/cpp/header/cstdlib [/url]
 #include <stdlib.h>
@@ -12,31 +14,78 @@
 /// [url] https://en.cppreference.com/w/cpp/header/ctgmath [/url]
 #include <tgmath.h>
 
+///====================================================================================================================================
+/// <summary>   Allocates vector with uninitialized components. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="pArena">	Arena or NULL for the heap. </param>
+/// <param name="type">		Type of vector components. </param>
+///
+/// <returns>	New vector or NULL. </returns>
+///====================================================================================================================================
+static PVECTOR AllocVector(PVECTOR_ARENA pArena, int type)
+{
+	const size_t cbComponent = GetComponentSize(type);
+
+	VECTOR* pVector = NULL;
+	if (pArena)
+	{
+		// Header and components share a single bump, the header is padded to keep the components aligned
+		const size_t cbHeader = (sizeof(VECTOR) + VECTOR_ARENA_ALIGNMENT - 1) / VECTOR_ARENA_ALIGNMENT * VECTOR_ARENA_ALIGNMENT;
+
+		pVector = (VECTOR*)ArenaAlloc(pArena, cbHeader + 2 * cbComponent, VECTOR_ARENA_ALIGNMENT);
+		if (!pVector)
+			return NULL;
+
+		pVector->external  = 1;
+		pVector->pX        = (char*)pVector + cbHeader;
+		pVector->pY        = (char*)pVector->pX + cbComponent;
+	}
+	else
+	{
+		pVector = (VECTOR*)calloc(1, sizeof(VECTOR));
+		if (!pVector)
+			return NULL;
+
+		// Counted before the components, a failure below is balanced by DeleteVector
+		VECTOR_STATS_ALLOC(sizeof(VECTOR) + 2 * cbComponent);
+
+		pVector->external  = 0;
+		pVector->pX        = calloc(1, cbComponent);
+		pVector->pY        = calloc(1, cbComponent);
+		if (!pVector->pX || !pVector->pY)
+		{
+			DeleteVector(pVector);
+
+			return NULL;
+		}
+	}
+
+	pVector->type = type;
+
+	return pVector;
+}
+
 ///====================================================================================================================================
 /// <summary>   Creates INT vector. </summary>
 ///
 /// <remarks>   MyLibh, 05.08.2019. </remarks>
 ///
-/// <param name="cX">	Value for x-component. </param>
-/// <param name="cY">	Value for y-component. </param>
+/// <param name="pArena">	Arena or NULL for the heap. </param>
+/// <param name="cX">		Value for x-component. </param>
+/// <param name="cY">		Value for y-component. </param>
 ///
 /// <returns>	New vector or NULL. </returns>
 ///====================================================================================================================================
-PVECTOR CreateIntVector(const int cX, const int cY)
+PVECTOR CreateIntVector(PVECTOR_ARENA pArena, const int cX, const int cY)
 {
-	VECTOR* pVector = (VECTOR*)calloc(1, sizeof(VECTOR));
+	VECTOR* pVector = AllocVector(pArena, VECTOR_INTEGRAL);
 	if (!pVector)
 		return NULL;
 
-	pVector->type = VECTOR_INTEGRAL;
-
-	pVector->pX = calloc(1, sizeof(int));
-	if(pVector->pX)
-		VEC_X(pVector, int) = cX;
-
-	pVector->pY = calloc(1, sizeof(int));
-	if (pVector->pY)
-		VEC_Y(pVector, int) = cY;
+	VEC_X(pVector, int) = cX;
+	VEC_Y(pVector, int) = cY;
 
 	return pVector;
 }
@@ -46,26 +95,20 @@ PVECTOR CreateIntVector(const int cX, const int cY)
 ///
 /// <remarks>   MyLibh, 05.08.2019. </remarks>
 ///
-/// <param name="cX">	Value for x-component. </param>
-/// <param name="cY">	Value for y-component. </param>
+/// <param name="pArena">	Arena or NULL for the heap. </param>
+/// <param name="cX">		Value for x-component. </param>
+/// <param name="cY">		Value for y-component. </param>
 ///
 /// <returns>	New vector or NULL. </returns>
 ///====================================================================================================================================
-PVECTOR CreateRealVector(const REAL cX, const REAL cY)
+PVECTOR CreateRealVector(PVECTOR_ARENA pArena, const REAL cX, const REAL cY)
 {
-	VECTOR* pVector = (VECTOR*)calloc(1, sizeof(VECTOR));
+	VECTOR* pVector = AllocVector(pArena, VECTOR_REAL);
 	if (!pVector)
 		return NULL;
 
-	pVector->type = VECTOR_REAL;
-
-	pVector->pX = calloc(1, sizeof(REAL));
-	if (pVector->pX)
-		VEC_X(pVector, REAL) = cX;
-
-	pVector->pY = calloc(1, sizeof(REAL));
-	if (pVector->pY)
-		VEC_Y(pVector, REAL) = cY;
+	VEC_X(pVector, REAL) = cX;
+	VEC_Y(pVector, REAL) = cY;
 
 	return pVector;
 }
@@ -75,46 +118,47 @@ PVECTOR CreateRealVector(const REAL cX, const REAL cY)
 ///
 /// <remarks>   MyLibh, 05.08.2019. </remarks>
 ///
-/// <param name="cpX">	Value for x-component. </param>
-/// <param name="cpY">	Value for y-component. </param>
+/// <param name="pArena">	Arena or NULL for the heap. </param>
+/// <param name="cpX">		Value for x-component. </param>
+/// <param name="cpY">		Value for y-component. </param>
 ///
 /// <returns>	New vector or NULL. </returns>
 ///====================================================================================================================================
-PVECTOR CreateComplexVector(COMPLEX const* cpX, COMPLEX const* cpY)
+PVECTOR CreateComplexVector(PVECTOR_ARENA pArena, COMPLEX const* cpX, COMPLEX const* cpY)
 {
-	VECTOR* pVector = (VECTOR*)calloc(1, sizeof(VECTOR));
+	VECTOR* pVector = AllocVector(pArena, VECTOR_COMPLEX);
 	if (!pVector)
 		return NULL;
 
-	pVector->type = VECTOR_COMPLEX;
-
-	pVector->pX = calloc(1, sizeof(COMPLEX));
-	if (pVector->pX)
-		VEC_X(pVector, COMPLEX) = *cpX;
-
-	pVector->pY = calloc(1, sizeof(COMPLEX));
-	if (pVector->pY)
-		VEC_Y(pVector, COMPLEX) = *cpY;
+	VEC_X(pVector, COMPLEX) = *cpX;
+	VEC_Y(pVector, COMPLEX) = *cpY;
 
 	return pVector;
 }
 
 PVECTOR CreateVector(int type, void const* cpX, void const* cpY)
+{
+	return CreateVectorIn(NULL, type, cpX, cpY);
+}
+
+PVECTOR CreateVectorIn(PVECTOR_ARENA pArena, int type, void const* cpX, void const* cpY)
 {
 	if (type == VECTOR_INTEGRAL)
-		return CreateIntVector(*(INT const*)cpX, *(INT const*)cpY);
+		return CreateIntVector(pArena, *(INT const*)cpX, *(INT const*)cpY);
 	else if (type == VECTOR_REAL)
-		return CreateRealVector(*(REAL const*)cpX, *(REAL const*)cpY);
+		return CreateRealVector(pArena, *(REAL const*)cpX, *(REAL const*)cpY);
 	else if (type == VECTOR_COMPLEX)
-		return CreateComplexVector(cpX, cpY);
+		return CreateComplexVector(pArena, cpX, cpY);
 	else
 		return NULL;
 }
 
 void DeleteVector(PVECTOR pVector)
 {
-	if (pVector)
+	if (pVector && !pVector->external)
 	{
+		VECTOR_STATS_FREE(sizeof(VECTOR) + 2 * GetComponentSize(pVector->type));
+
 		if (pVector->pX)
 		{
 			free(pVector->pX);
@@ -133,44 +177,271 @@ void DeleteVector(PVECTOR pVector)
 }
 
 PVECTOR Sum(const PVECTOR cpLHV, const PVECTOR cpRHV)
+{
+	return SumIn(NULL, cpLHV, cpRHV);
+}
+
+PVECTOR SumIn(PVECTOR_ARENA pArena, const PVECTOR cpLHV, const PVECTOR cpRHV)
 {
 	assert(cpLHV->type == cpRHV->type);
 
+	PVECTOR pResult = AllocVector(pArena, cpLHV->type);
+	if (!pResult)
+		return NULL;
+
+	if (SumInto(pResult, cpLHV, cpRHV) != VECTOR_OK)
+	{
+		DeleteVector(pResult);
+
+		return NULL;
+	}
+
+	return pResult;
+}
+
+///====================================================================================================================================
+/// <summary>   Validates operands of the arithmetic operations. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="cpDst">	Destination vector. </param>
+/// <param name="cpLHV">	Vector. </param>
+/// <param name="cpRHV">	Vector or NULL for unary operations. </param>
+///
+/// <returns>	VECTOR_OK or error code. </returns>
+///====================================================================================================================================
+static int CheckOperands(const PVECTOR cpDst, const PVECTOR cpLHV, const PVECTOR cpRHV)
+{
+	if (!cpDst || !cpLHV || !cpDst->pX || !cpDst->pY || !cpLHV->pX || !cpLHV->pY)
+		return VECTOR_E_INVALID_ARG;
+
+	if (cpRHV && (!cpRHV->pX || !cpRHV->pY))
+		return VECTOR_E_INVALID_ARG;
+
+	if (cpDst->type != cpLHV->type || (cpRHV && cpRHV->type != cpLHV->type))
+		return VECTOR_E_TYPE_MISMATCH;
+
+	if (cpLHV->type != VECTOR_INTEGRAL && cpLHV->type != VECTOR_REAL && cpLHV->type != VECTOR_COMPLEX)
+		return VECTOR_E_UNKNOWN_TYPE;
+
+	return VECTOR_OK;
+}
+
+int InitVector(PVECTOR pVector, int type, void* pX, void* pY)
+{
+	if (!pVector || !pX || !pY)
+		return VECTOR_E_INVALID_ARG;
+
+	if (type != VECTOR_INTEGRAL && type != VECTOR_REAL && type != VECTOR_COMPLEX)
+		return VECTOR_E_UNKNOWN_TYPE;
+
+	pVector->type     = type;
+	pVector->external = 1;
+	pVector->pX       = pX;
+	pVector->pY       = pY;
+
+	return VECTOR_OK;
+}
+
+int SumInto(PVECTOR pDst, const PVECTOR cpLHV, const PVECTOR cpRHV)
+{
+	const int status = CheckOperands(pDst, cpLHV, cpRHV);
+	if (status != VECTOR_OK)
+		return status;
+
+	VECTOR_STATS_OP_BEGIN(VECTOR_OP_ADD, cpLHV->type);
+
+	if (cpLHV->type == VECTOR_INTEGRAL)
+	{
+		VEC_X(pDst, INT) = VEC_X(cpLHV, INT) + VEC_X(cpRHV, INT);
+		VEC_Y(pDst, INT) = VEC_Y(cpLHV, INT) + VEC_Y(cpRHV, INT);
+	}
+	else if (cpLHV->type == VECTOR_REAL)
+	{
+		VEC_X(pDst, REAL) = VEC_X(cpLHV, REAL) + VEC_X(cpRHV, REAL);
+		VEC_Y(pDst, REAL) = VEC_Y(cpLHV, REAL) + VEC_Y(cpRHV, REAL);
+	}
+	else
+	{
+		VEC_X(pDst, COMPLEX) = _LCOMPLEX_(creall(VEC_X(cpLHV, COMPLEX)) + creall(VEC_X(cpRHV, COMPLEX)), cimagl(VEC_X(cpLHV, COMPLEX)) + cimagl(VEC_X(cpRHV, COMPLEX)));
+		VEC_Y(pDst, COMPLEX) = _LCOMPLEX_(creall(VEC_Y(cpLHV, COMPLEX)) + creall(VEC_Y(cpRHV, COMPLEX)), cimagl(VEC_Y(cpLHV, COMPLEX)) + cimagl(VEC_Y(cpRHV, COMPLEX)));
+	}
+
+	VECTOR_STATS_OP_END();
+
+	return VECTOR_OK;
+}
+
+int SubInto(PVECTOR pDst, const PVECTOR cpLHV, const PVECTOR cpRHV)
+{
+	const int status = CheckOperands(pDst, cpLHV, cpRHV);
+	if (status != VECTOR_OK)
+		return status;
+
+	VECTOR_STATS_OP_BEGIN(VECTOR_OP_SUB, cpLHV->type);
+
 	if (cpLHV->type == VECTOR_INTEGRAL)
-		return CreateIntVector(VEC_X(cpLHV, INT) + VEC_X(cpRHV, INT), VEC_Y(cpLHV, INT) + VEC_Y(cpRHV, INT));
+	{
+		VEC_X(pDst, INT) = VEC_X(cpLHV, INT) - VEC_X(cpRHV, INT);
+		VEC_Y(pDst, INT) = VEC_Y(cpLHV, INT) - VEC_Y(cpRHV, INT);
+	}
 	else if (cpLHV->type == VECTOR_REAL)
-		return CreateRealVector(VEC_X(cpLHV, REAL) + VEC_X(cpRHV, REAL), VEC_Y(cpLHV, REAL) + VEC_Y(cpRHV, REAL));
-	else if (cpLHV->type == VECTOR_COMPLEX)
 	{
-		COMPLEX x = _LCOMPLEX_(creall(VEC_X(cpLHV, COMPLEX)) + creall(VEC_X(cpRHV, COMPLEX)), cimagl(VEC_X(cpLHV, COMPLEX)) + cimagl(VEC_X(cpRHV, COMPLEX)));
-		COMPLEX y = _LCOMPLEX_(creall(VEC_Y(cpLHV, COMPLEX)) + creall(VEC_Y(cpRHV, COMPLEX)), cimagl(VEC_Y(cpLHV, COMPLEX)) + cimagl(VEC_Y(cpRHV, COMPLEX)));
+		VEC_X(pDst, REAL) = VEC_X(cpLHV, REAL) - VEC_X(cpRHV, REAL);
+		VEC_Y(pDst, REAL) = VEC_Y(cpLHV, REAL) - VEC_Y(cpRHV, REAL);
+	}
+	else
+	{
+		VEC_X(pDst, COMPLEX) = _LCOMPLEX_(creall(VEC_X(cpLHV, COMPLEX)) - creall(VEC_X(cpRHV, COMPLEX)), cimagl(VEC_X(cpLHV, COMPLEX)) - cimagl(VEC_X(cpRHV, COMPLEX)));
+		VEC_Y(pDst, COMPLEX) = _LCOMPLEX_(creall(VEC_Y(cpLHV, COMPLEX)) - creall(VEC_Y(cpRHV, COMPLEX)), cimagl(VEC_Y(cpLHV, COMPLEX)) - cimagl(VEC_Y(cpRHV, COMPLEX)));
+	}
+
+	VECTOR_STATS_OP_END();
+
+	return VECTOR_OK;
+}
+
+int ScaleInto(PVECTOR pDst, const PVECTOR cpVector, void const* cpFactor)
+{
+	if (!cpFactor)
+		return VECTOR_E_INVALID_ARG;
+
+	const int status = CheckOperands(pDst, cpVector, NULL);
+	if (status != VECTOR_OK)
+		return status;
+
+	VECTOR_STATS_OP_BEGIN(VECTOR_OP_SCALE, cpVector->type);
 
-		return CreateComplexVector(&x, &y);
+	if (cpVector->type == VECTOR_INTEGRAL)
+	{
+		const INT factor = *(INT const*)cpFactor;
+		VEC_X(pDst, INT) = VEC_X(cpVector, INT) * factor;
+		VEC_Y(pDst, INT) = VEC_Y(cpVector, INT) * factor;
+	}
+	else if (cpVector->type == VECTOR_REAL)
+	{
+		const REAL factor = *(REAL const*)cpFactor;
+		VEC_X(pDst, REAL) = VEC_X(cpVector, REAL) * factor;
+		VEC_Y(pDst, REAL) = VEC_Y(cpVector, REAL) * factor;
 	}
 	else
-		return NULL;
+	{
+		const COMPLEX factor = *(COMPLEX const*)cpFactor;
+		VEC_X(pDst, COMPLEX) = _LCmulcc(VEC_X(cpVector, COMPLEX), factor);
+		VEC_Y(pDst, COMPLEX) = _LCmulcc(VEC_Y(cpVector, COMPLEX), factor);
+	}
+
+	VECTOR_STATS_OP_END();
+
+	return VECTOR_OK;
+}
+
+int FmaInto(PVECTOR pDst, const PVECTOR cpLHV, void const* cpFactor, const PVECTOR cpRHV)
+{
+	if (!cpFactor)
+		return VECTOR_E_INVALID_ARG;
+
+	const int status = CheckOperands(pDst, cpLHV, cpRHV);
+	if (status != VECTOR_OK)
+		return status;
+
+	VECTOR_STATS_OP_BEGIN(VECTOR_OP_FMA, cpLHV->type);
+
+	if (cpLHV->type == VECTOR_INTEGRAL)
+	{
+		const INT factor = *(INT const*)cpFactor;
+		VEC_X(pDst, INT) = VEC_X(cpLHV, INT) * factor + VEC_X(cpRHV, INT);
+		VEC_Y(pDst, INT) = VEC_Y(cpLHV, INT) * factor + VEC_Y(cpRHV, INT);
+	}
+	else if (cpLHV->type == VECTOR_REAL)
+	{
+		const REAL factor = *(REAL const*)cpFactor;
+		VEC_X(pDst, REAL) = fmal(VEC_X(cpLHV, REAL), factor, VEC_X(cpRHV, REAL));
+		VEC_Y(pDst, REAL) = fmal(VEC_Y(cpLHV, REAL), factor, VEC_Y(cpRHV, REAL));
+	}
+	else
+	{
+		const COMPLEX factor = *(COMPLEX const*)cpFactor;
+		const COMPLEX x      = _LCmulcc(VEC_X(cpLHV, COMPLEX), factor);
+		const COMPLEX y      = _LCmulcc(VEC_Y(cpLHV, COMPLEX), factor);
+
+		VEC_X(pDst, COMPLEX) = _LCOMPLEX_(creall(x) + creall(VEC_X(cpRHV, COMPLEX)), cimagl(x) + cimagl(VEC_X(cpRHV, COMPLEX)));
+		VEC_Y(pDst, COMPLEX) = _LCOMPLEX_(creall(y) + creall(VEC_Y(cpRHV, COMPLEX)), cimagl(y) + cimagl(VEC_Y(cpRHV, COMPLEX)));
+	}
+
+	VECTOR_STATS_OP_END();
+
+	return VECTOR_OK;
+}
+
+int AddAssign(PVECTOR pDst, const PVECTOR cpRHV)
+{
+	return SumInto(pDst, pDst, cpRHV);
+}
+
+int SubAssign(PVECTOR pDst, const PVECTOR cpRHV)
+{
+	return SubInto(pDst, pDst, cpRHV);
+}
+
+int ScaleAssign(PVECTOR pDst, void const* cpFactor)
+{
+	return ScaleInto(pDst, pDst, cpFactor);
 }
 
-#pragma warning(push)
-#pragma warning(disable:4715) // 'ScalarProduct': not all control paths return a value
 REAL ScalarProduct(const PVECTOR cpLHV, const PVECTOR cpRHV)
 {
 	assert(cpLHV->type == cpRHV->type);
 
+	REAL result = 0;
+	if (ScalarProductInto(&result, cpLHV, cpRHV) != VECTOR_OK)
+		abort();
+
+	return result;
+}
+
+int ScalarProductInto(REAL* pResult, const PVECTOR cpLHV, const PVECTOR cpRHV)
+{
+	if (!pResult)
+		return VECTOR_E_INVALID_ARG;
+
+	const int status = CheckOperands(cpLHV, cpLHV, cpRHV);
+	if (status != VECTOR_OK)
+		return status;
+
+	VECTOR_STATS_OP_BEGIN(VECTOR_OP_SCALAR_PRODUCT, cpLHV->type);
+
 	if (cpLHV->type == VECTOR_INTEGRAL)
-		return ((REAL)VEC_X(cpLHV, INT) * VEC_X(cpRHV, INT) + (REAL)VEC_Y(cpLHV, INT) * VEC_Y(cpRHV, INT));
+		*pResult = ((REAL)VEC_X(cpLHV, INT) * VEC_X(cpRHV, INT) + (REAL)VEC_Y(cpLHV, INT) * VEC_Y(cpRHV, INT));
 	else if (cpLHV->type == VECTOR_REAL)
-		return (VEC_X(cpLHV, REAL) * VEC_X(cpRHV, REAL) + VEC_Y(cpLHV, REAL) * VEC_Y(cpRHV, REAL));
-	else if (cpLHV->type == VECTOR_COMPLEX)
-		return (REAL)(creall(_LCmulcc(VEC_X(cpLHV, COMPLEX), conjl(VEC_X(cpRHV, COMPLEX)))) + creall(_LCmulcc(VEC_Y(cpLHV, COMPLEX), conjl(VEC_Y(cpRHV, COMPLEX)))));
+		*pResult = (VEC_X(cpLHV, REAL) * VEC_X(cpRHV, REAL) + VEC_Y(cpLHV, REAL) * VEC_Y(cpRHV, REAL));
+	else
+		*pResult = (REAL)(creall(_LCmulcc(VEC_X(cpLHV, COMPLEX), conjl(VEC_X(cpRHV, COMPLEX)))) + creall(_LCmulcc(VEC_Y(cpLHV, COMPLEX), conjl(VEC_Y(cpRHV, COMPLEX)))));
+
+	VECTOR_STATS_OP_END();
 
-	abort();
+	return VECTOR_OK;
+}
+
+size_t GetComponentSize(int type)
+{
+	if (type == VECTOR_INTEGRAL)
+		return sizeof(INT);
+	else if (type == VECTOR_REAL)
+		return sizeof(REAL);
+	else if (type == VECTOR_COMPLEX)
+		return sizeof(COMPLEX);
+	else if (type == VECTOR_FLOAT)
+		return sizeof(FLOAT);
+	else if (type == VECTOR_DOUBLE)
+		return sizeof(DOUBLE);
+	else
+		return 0;
 }
-#pragma warning(pop)
 
 void Dump(const PVECTOR cpVector)
 {
-	static const char* SCP_VECTOR_TYPE[] = { {"int"}, {"long double"}, {"complex"} };
+	static const char* SCP_VECTOR_TYPE[] = { "int", "long double", "complex" };
 
 	printf("[VECTOR DUMP]\n\tVECTOR (%s) [0x%p]\n\t{\n", SCP_VECTOR_TYPE[cpVector->type], cpVector);
 	if (cpVector->type == VECTOR_INTEGRAL)
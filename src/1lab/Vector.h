@@ -6,7 +6,7 @@
 /// Created:			05.08.2019
 ///
 /// Last modified by:	MyLibh
-/// Last modified on:	05.08.2019
+/// Last modified on:	17.10.2026
 ///====================================================================================================================================
 /// Copyright(c) MyLibh. All rights reserved.
 ///====================================================================================================================================
@@ -16,28 +16,73 @@
 
 /// [url] https://docs.microsoft.com/en-us/cpp/c-runtime-library/complex-math-support?view=vs-2019 [/url]
 #include <complex.h>
+/// [url] https://en.cppreference.com/w/c/types/size_t [/url]
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#ifndef _MSC_VER
+// MSVC complex.h API on top of the C99 complex types
+typedef long double _Complex _Lcomplex;
+
+#ifndef __cplusplus
+#ifdef CMPLXL
+#define _LCOMPLEX_(re, im) CMPLXL(re, im)
+#else
+#define _LCOMPLEX_(re, im) ((long double)(re) + (long double)(im) * _Complex_I)
+#endif /* CMPLXL */
+
+#define _LCmulcc(lhs, rhs) ((lhs) * (rhs))
+#endif /* __cplusplus */
+#endif /* _MSC_VER */
 
 typedef int         INT;
 typedef long double REAL;
 typedef _Lcomplex   COMPLEX;
+typedef float       FLOAT;
+typedef double      DOUBLE;
 
 #define VECTOR_INTEGRAL	0x0	
 #define VECTOR_REAL     0x1
 #define VECTOR_COMPLEX  0x2
+#define VECTOR_FLOAT    0x3 /* VECTOR_BATCH only */
+#define VECTOR_DOUBLE   0x4 /* VECTOR_BATCH only */
+
+#define VECTOR_TYPE_COUNT 5
+
+#define VECTOR_OK              0x0
+#define VECTOR_E_INVALID_ARG   0x1
+#define VECTOR_E_TYPE_MISMATCH 0x2
+#define VECTOR_E_UNKNOWN_TYPE  0x3
+#define VECTOR_E_NO_MEMORY     0x4
+#define VECTOR_E_IO            0x5
+#define VECTOR_E_BAD_FORMAT    0x6
 
 ///====================================================================================================================================
 /// <summary>   A two-dimensional vector. </summary>
 ///
-/// <remarks>	MyLibh, 05.08.2019. </remarks>
+/// <remarks>
+/// 	MyLibh, 05.08.2019. External vectors live in an arena or in caller's storage and are never freed by DeleteVector.
+/// </remarks>
 ///====================================================================================================================================
 
 typedef struct _Vector
 {
-	int   type : 2;
-	void* pX;
-	void* pY;
+	unsigned type     : 3;
+	unsigned external : 1;
+	void*    pX;
+	void*    pY;
 } VECTOR, *PVECTOR;
 
+///====================================================================================================================================
+/// <summary>   Arena the vectors can be allocated from, see VectorArena.h. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+typedef struct _VectorArena VECTOR_ARENA, *PVECTOR_ARENA;
+
 ///====================================================================================================================================
 /// <summary>   Macro for x-component. </summary>
 ///
@@ -66,7 +111,21 @@ typedef struct _Vector
 PVECTOR CreateVector(int type, void const* cpX, void const* cpY);
 
 ///====================================================================================================================================
-/// <summary>   Deletes vector. </summary>
+/// <summary>   Creates vector in the arena. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="pArena">	Arena or NULL for the heap. </param>
+/// <param name="type">		Type of vector components. </param>
+/// <param name="cpX">		Value for x-component. </param>
+/// <param name="cpY">		Value for y-component. </param>
+///
+/// <returns>	New vector or NULL. </returns>
+///====================================================================================================================================
+PVECTOR CreateVectorIn(PVECTOR_ARENA pArena, int type, void const* cpX, void const* cpY);
+
+///====================================================================================================================================
+/// <summary>   Deletes vector. Vectors allocated from an arena are released with the arena. </summary>
 ///
 /// <remarks>   MyLibh, 05.08.2019. </remarks>
 ///
@@ -86,6 +145,122 @@ void DeleteVector(PVECTOR cpVector);
 ///====================================================================================================================================
 PVECTOR Sum(const PVECTOR cpLHV, const PVECTOR cpRHV);
 
+///====================================================================================================================================
+/// <summary>   Calculates sum of two vectors into the arena. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="pArena"> Arena or NULL for the heap. </param>
+/// <param name="cpLHV">  Vector. </param>
+/// <param name="cpRHV">  Vector. </param>
+///
+/// <returns>	Result of the sum of vectors. </returns>
+///====================================================================================================================================
+PVECTOR SumIn(PVECTOR_ARENA pArena, const PVECTOR cpLHV, const PVECTOR cpRHV);
+
+///====================================================================================================================================
+/// <summary>   Binds vector to caller-owned components, e.g. ones on the stack. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="pVector">	Vector. </param>
+/// <param name="type">		Type of vector components. </param>
+/// <param name="pX">		Storage for x-component. </param>
+/// <param name="pY">		Storage for y-component. </param>
+///
+/// <returns>	VECTOR_OK or error code. </returns>
+///====================================================================================================================================
+int InitVector(PVECTOR pVector, int type, void* pX, void* pY);
+
+///====================================================================================================================================
+/// <summary>   Calculates sum of two vectors into the destination vector. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. The destination may be one of the operands. </remarks>
+///
+/// <param name="pDst">  Destination vector. </param>
+/// <param name="cpLHV"> Vector. </param>
+/// <param name="cpRHV"> Vector. </param>
+///
+/// <returns>	VECTOR_OK or error code. </returns>
+///====================================================================================================================================
+int SumInto(PVECTOR pDst, const PVECTOR cpLHV, const PVECTOR cpRHV);
+
+///====================================================================================================================================
+/// <summary>   Calculates difference of two vectors into the destination vector. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. The destination may be one of the operands. </remarks>
+///
+/// <param name="pDst">  Destination vector. </param>
+/// <param name="cpLHV"> Vector. </param>
+/// <param name="cpRHV"> Vector. </param>
+///
+/// <returns>	VECTOR_OK or error code. </returns>
+///====================================================================================================================================
+int SubInto(PVECTOR pDst, const PVECTOR cpLHV, const PVECTOR cpRHV);
+
+///====================================================================================================================================
+/// <summary>   Multiplies vector by the factor into the destination vector. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. The destination may be the operand. </remarks>
+///
+/// <param name="pDst">		Destination vector. </param>
+/// <param name="cpVector">	Vector. </param>
+/// <param name="cpFactor">	Factor of the component type. </param>
+///
+/// <returns>	VECTOR_OK or error code. </returns>
+///====================================================================================================================================
+int ScaleInto(PVECTOR pDst, const PVECTOR cpVector, void const* cpFactor);
+
+///====================================================================================================================================
+/// <summary>   Calculates cpLHV * factor + cpRHV into the destination vector. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. The destination may be one of the operands. </remarks>
+///
+/// <param name="pDst">		Destination vector. </param>
+/// <param name="cpLHV">	Vector to scale. </param>
+/// <param name="cpFactor">	Factor of the component type. </param>
+/// <param name="cpRHV">	Vector to add. </param>
+///
+/// <returns>	VECTOR_OK or error code. </returns>
+///====================================================================================================================================
+int FmaInto(PVECTOR pDst, const PVECTOR cpLHV, void const* cpFactor, const PVECTOR cpRHV);
+
+///====================================================================================================================================
+/// <summary>   Adds vector to the destination vector. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="pDst">  Destination vector. </param>
+/// <param name="cpRHV"> Vector. </param>
+///
+/// <returns>	VECTOR_OK or error code. </returns>
+///====================================================================================================================================
+int AddAssign(PVECTOR pDst, const PVECTOR cpRHV);
+
+///====================================================================================================================================
+/// <summary>   Subtracts vector from the destination vector. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="pDst">  Destination vector. </param>
+/// <param name="cpRHV"> Vector. </param>
+///
+/// <returns>	VECTOR_OK or error code. </returns>
+///====================================================================================================================================
+int SubAssign(PVECTOR pDst, const PVECTOR cpRHV);
+
+///====================================================================================================================================
+/// <summary>   Multiplies the destination vector by the factor. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="pDst">		Destination vector. </param>
+/// <param name="cpFactor">	Factor of the component type. </param>
+///
+/// <returns>	VECTOR_OK or error code. </returns>
+///====================================================================================================================================
+int ScaleAssign(PVECTOR pDst, void const* cpFactor);
+
 ///====================================================================================================================================
 /// <summary>   Calculates scalar product. </summary>
 ///
@@ -98,6 +273,30 @@ PVECTOR Sum(const PVECTOR cpLHV, const PVECTOR cpRHV);
 ///====================================================================================================================================
 REAL ScalarProduct(const PVECTOR cpLHV, const PVECTOR cpRHV);
 
+///====================================================================================================================================
+/// <summary>   Calculates scalar product without aborting on invalid arguments. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="pResult"> Scalar product. </param>
+/// <param name="cpLHV">   Vector. </param>
+/// <param name="cpRHV">   Vector. </param>
+///
+/// <returns>	VECTOR_OK or error code. </returns>
+///====================================================================================================================================
+int ScalarProductInto(REAL* pResult, const PVECTOR cpLHV, const PVECTOR cpRHV);
+
+///====================================================================================================================================
+/// <summary>   Gets size of the vector component. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="type"> Type of vector components. </param>
+///
+/// <returns>	Size of one component in bytes or 0 for unknown type. </returns>
+///====================================================================================================================================
+size_t GetComponentSize(int type);
+
 ///====================================================================================================================================
 /// <summary>   Dumps vector info into the STDOUT. </summary>
 ///
@@ -107,4 +306,8 @@ REAL ScalarProduct(const PVECTOR cpLHV, const PVECTOR cpRHV);
 ///====================================================================================================================================
 void Dump(const PVECTOR cpVector);
 
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
 #endif /* __VECTOR_H_INCLUDED__ */
\ No newline at end of file
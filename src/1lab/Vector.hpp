@@ -0,0 +1,409 @@
+#pragma once
+
+///====================================================================================================================================
+/// File:				Vector.hpp
+/// Author:				MyLibh
+/// Created:			17.10.2026
+///
+/// Last modified by:	MyLibh
+/// Last modified on:	17.10.2026
+///====================================================================================================================================
+/// Copyright(c) MyLibh. All rights reserved.
+///====================================================================================================================================
+
+#ifndef __VECTOR_HPP_INCLUDED__
+#define __VECTOR_HPP_INCLUDED__
+
+#ifndef __cplusplus
+#error
+#error Must use C++ to compile.
+#error
+#endif /* __cplusplus */
+
+#if ((defined(_MSVC_LANG) ? _MSVC_LANG : __cplusplus) < 201703L)
+#error
+#error Must use ISO C++17 Standart
+#error
+#endif /* __cplusplus < 201703L */
+
+#include "Vector.h"
+
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+///====================================================================================================================================
+/// <summary>   Base of the vector expressions. Operators build expression trees that are evaluated in one fused loop. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. Every expression has value_type, static size and operator[]. </remarks>
+///====================================================================================================================================
+template<typename E>
+struct VectorExpression
+{
+	[[nodiscard]]
+	constexpr E const& self() const noexcept { return static_cast<E const&>(*this); }
+
+	[[nodiscard]]
+	constexpr decltype(auto) operator[](std::size_t i) const { return self()[i]; }
+};
+
+template<typename T, std::size_t N>
+class Vector;
+
+namespace vector_detail
+{
+	template<typename E>
+	struct is_vector : std::false_type { };
+
+	template<typename T, std::size_t N>
+	struct is_vector<Vector<T, N>> : std::true_type { };
+
+	// Vectors are captured by reference, expression nodes by value, so that `auto e = a + b + c;` doesn't dangle
+	template<typename E>
+	using operand_t = std::conditional_t<is_vector<E>::value, E const&, E const>;
+
+	template<typename T>
+	struct is_complex : std::false_type { };
+
+	template<typename T>
+	struct is_complex<std::complex<T>> : std::true_type { };
+
+	template<typename T>
+	constexpr T conj_if_complex(T const& val)
+	{
+		if constexpr (is_complex<T>::value)
+			return std::conj(val);
+		else
+			return val;
+	}
+
+	struct plus       { template<typename L, typename R> static constexpr auto apply(L const& l, R const& r) { return l + r; } };
+	struct minus      { template<typename L, typename R> static constexpr auto apply(L const& l, R const& r) { return l - r; } };
+	struct multiplies { template<typename L, typename R> static constexpr auto apply(L const& l, R const& r) { return l * r; } };
+	struct divides    { template<typename L, typename R> static constexpr auto apply(L const& l, R const& r) { return l / r; } };
+} // namespace vector_detail
+
+///====================================================================================================================================
+/// <summary>   Element-wise binary operation on two expressions of the same dimension. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+template<typename L, typename R, typename Op>
+class VectorBinaryExpression : public VectorExpression<VectorBinaryExpression<L, R, Op>>
+{
+	static_assert(L::size == R::size, "Vectors must have the same dimension.");
+
+public:
+	using value_type = decltype(Op::apply(std::declval<typename L::value_type>(), std::declval<typename R::value_type>()));
+
+	static constexpr std::size_t size = L::size;
+
+	constexpr VectorBinaryExpression(L const& crLHS, R const& crRHS) noexcept :
+		m_lhs(crLHS),
+		m_rhs(crRHS)
+	{ }
+
+	[[nodiscard]]
+	constexpr value_type operator[](std::size_t i) const { return Op::apply(m_lhs[i], m_rhs[i]); }
+
+private:
+	vector_detail::operand_t<L> m_lhs;
+	vector_detail::operand_t<R> m_rhs;
+};
+
+///====================================================================================================================================
+/// <summary>   Element-wise operation on an expression and a scalar. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+template<typename E, typename S, typename Op, bool ScalarOnLeft = false>
+class VectorScalarExpression : public VectorExpression<VectorScalarExpression<E, S, Op, ScalarOnLeft>>
+{
+public:
+	using value_type = std::conditional_t<ScalarOnLeft,
+	                                      decltype(Op::apply(std::declval<S>(), std::declval<typename E::value_type>())),
+	                                      decltype(Op::apply(std::declval<typename E::value_type>(), std::declval<S>()))>;
+
+	static constexpr std::size_t size = E::size;
+
+	constexpr VectorScalarExpression(E const& crExpr, S const& crScalar) noexcept :
+		m_expr(crExpr),
+		m_scalar(crScalar)
+	{ }
+
+	[[nodiscard]]
+	constexpr value_type operator[](std::size_t i) const
+	{
+		if constexpr (ScalarOnLeft)
+			return Op::apply(m_scalar, m_expr[i]);
+		else
+			return Op::apply(m_expr[i], m_scalar);
+	}
+
+private:
+	vector_detail::operand_t<E> m_expr;
+	S                           m_scalar;
+};
+
+///====================================================================================================================================
+/// <summary>   Element-wise negation. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+template<typename E>
+class VectorNegateExpression : public VectorExpression<VectorNegateExpression<E>>
+{
+public:
+	using value_type = typename E::value_type;
+
+	static constexpr std::size_t size = E::size;
+
+	explicit constexpr VectorNegateExpression(E const& crExpr) noexcept :
+		m_expr(crExpr)
+	{ }
+
+	[[nodiscard]]
+	constexpr value_type operator[](std::size_t i) const { return -m_expr[i]; }
+
+private:
+	vector_detail::operand_t<E> m_expr;
+};
+
+///====================================================================================================================================
+/// <summary>   N-dimensional vector with inline storage. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+template<typename T, std::size_t N>
+class Vector : public VectorExpression<Vector<T, N>>
+{
+	static_assert(N > 0, "Vector must have at least one component.");
+
+public:
+	using value_type = T;
+
+	static constexpr std::size_t size = N;
+
+	constexpr Vector() noexcept :
+		m_data{}
+	{ }
+
+	constexpr Vector(std::initializer_list<T> list) :
+		m_data{}
+	{
+		if (list.size() > N)
+			throw std::out_of_range("Too many components.");
+
+		std::size_t i{};
+		for (auto&& val : list)
+			m_data[i++] = val;
+	}
+
+	template<typename E>
+	constexpr Vector(VectorExpression<E> const& crExpr) :
+		m_data{}
+	{
+		assign(crExpr.self());
+	}
+
+	template<typename E>
+	constexpr Vector& operator=(VectorExpression<E> const& crExpr)
+	{
+		// Evaluating into a temporary keeps `a = b + a` correct when the expression refers to this vector
+		Vector tmp(crExpr);
+		m_data = tmp.m_data;
+
+		return (*this);
+	}
+
+	template<typename E>
+	constexpr Vector& operator+=(VectorExpression<E> const& crExpr)
+	{
+		static_assert(E::size == N, "Vectors must have the same dimension.");
+
+		for (std::size_t i{}; i < N; ++i)
+			m_data[i] += crExpr.self()[i];
+
+		return (*this);
+	}
+
+	template<typename E>
+	constexpr Vector& operator-=(VectorExpression<E> const& crExpr)
+	{
+		static_assert(E::size == N, "Vectors must have the same dimension.");
+
+		for (std::size_t i{}; i < N; ++i)
+			m_data[i] -= crExpr.self()[i];
+
+		return (*this);
+	}
+
+	constexpr Vector& operator*=(T const& crFactor)
+	{
+		for (auto& val : m_data)
+			val *= crFactor;
+
+		return (*this);
+	}
+
+	[[nodiscard]]
+	constexpr T& operator[](std::size_t i) noexcept { return m_data[i]; }
+
+	[[nodiscard]]
+	constexpr T const& operator[](std::size_t i) const noexcept { return m_data[i]; }
+
+	[[nodiscard]]
+	constexpr T* data() noexcept { return m_data.data(); }
+
+	[[nodiscard]]
+	constexpr T const* data() const noexcept { return m_data.data(); }
+
+	[[nodiscard]]
+	constexpr auto begin() noexcept { return std::begin(m_data); }
+
+	[[nodiscard]]
+	constexpr auto end() noexcept { return std::end(m_data); }
+
+	[[nodiscard]]
+	constexpr auto begin() const noexcept { return std::cbegin(m_data); }
+
+	[[nodiscard]]
+	constexpr auto end() const noexcept { return std::cend(m_data); }
+
+private:
+	template<typename E>
+	constexpr void assign(E const& crExpr)
+	{
+		static_assert(E::size == N, "Vectors must have the same dimension.");
+
+		for (std::size_t i{}; i < N; ++i)
+			m_data[i] = static_cast<T>(crExpr[i]);
+	}
+
+	std::array<T, N> m_data;
+};
+
+template<typename L, typename R>
+[[nodiscard]]
+constexpr auto operator+(VectorExpression<L> const& crLHS, VectorExpression<R> const& crRHS)
+{
+	return VectorBinaryExpression<L, R, vector_detail::plus>(crLHS.self(), crRHS.self());
+}
+
+template<typename L, typename R>
+[[nodiscard]]
+constexpr auto operator-(VectorExpression<L> const& crLHS, VectorExpression<R> const& crRHS)
+{
+	return VectorBinaryExpression<L, R, vector_detail::minus>(crLHS.self(), crRHS.self());
+}
+
+template<typename E>
+[[nodiscard]]
+constexpr auto operator-(VectorExpression<E> const& crExpr)
+{
+	return VectorNegateExpression<E>(crExpr.self());
+}
+
+template<typename E, typename S, typename = std::enable_if_t<!std::is_base_of_v<VectorExpression<S>, S>>>
+[[nodiscard]]
+constexpr auto operator*(VectorExpression<E> const& crExpr, S const& crScalar)
+{
+	return VectorScalarExpression<E, S, vector_detail::multiplies>(crExpr.self(), crScalar);
+}
+
+template<typename S, typename E, typename = std::enable_if_t<!std::is_base_of_v<VectorExpression<S>, S>>>
+[[nodiscard]]
+constexpr auto operator*(S const& crScalar, VectorExpression<E> const& crExpr)
+{
+	return VectorScalarExpression<E, S, vector_detail::multiplies, true>(crExpr.self(), crScalar);
+}
+
+template<typename E, typename S, typename = std::enable_if_t<!std::is_base_of_v<VectorExpression<S>, S>>>
+[[nodiscard]]
+constexpr auto operator/(VectorExpression<E> const& crExpr, S const& crScalar)
+{
+	return VectorScalarExpression<E, S, vector_detail::divides>(crExpr.self(), crScalar);
+}
+
+///====================================================================================================================================
+/// <summary>   Calculates scalar product of two expressions in a single loop. The right operand is conjugated for complex values. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+template<typename L, typename R>
+[[nodiscard]]
+constexpr auto dot(VectorExpression<L> const& crLHS, VectorExpression<R> const& crRHS)
+{
+	static_assert(L::size == R::size, "Vectors must have the same dimension.");
+
+	using result_t = decltype(std::declval<typename L::value_type>() * vector_detail::conj_if_complex(std::declval<typename R::value_type>()));
+
+	result_t result{};
+	for (std::size_t i{}; i < L::size; ++i)
+		result += crLHS.self()[i] * vector_detail::conj_if_complex(crRHS.self()[i]);
+
+	return result;
+}
+
+///====================================================================================================================================
+/// Interoperability with the C VECTOR.
+///====================================================================================================================================
+
+namespace vector_detail
+{
+	template<typename T>
+	struct vector_type_code;
+
+	template<>
+	struct vector_type_code<INT> : std::integral_constant<int, VECTOR_INTEGRAL> { };
+
+	template<>
+	struct vector_type_code<REAL> : std::integral_constant<int, VECTOR_REAL> { };
+
+	// std::complex is layout-compatible with an array of two components, just as the C complex types
+	template<>
+	struct vector_type_code<std::complex<REAL>> : std::integral_constant<int, VECTOR_COMPLEX> { };
+
+	static_assert(sizeof(std::complex<REAL>) == sizeof(COMPLEX), "COMPLEX must be layout-compatible with std::complex<REAL>.");
+} // namespace vector_detail
+
+///====================================================================================================================================
+/// <summary>   Binds VECTOR to the storage of the two-dimensional vector without copying. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. The VECTOR is external and valid while the source vector is alive. </remarks>
+///====================================================================================================================================
+template<typename T>
+[[nodiscard]]
+VECTOR as_VECTOR(Vector<T, 2>& rVector)
+{
+	VECTOR vector{};
+	if (InitVector(&vector, vector_detail::vector_type_code<T>::value, &rVector[0], &rVector[1]) != VECTOR_OK)
+		throw std::invalid_argument("Unsupported vector type.");
+
+	return vector;
+}
+
+///====================================================================================================================================
+/// <summary>   Copies VECTOR into the two-dimensional vector. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+template<typename T>
+[[nodiscard]]
+Vector<T, 2> from_VECTOR(VECTOR const& crVector)
+{
+	if (crVector.type != vector_detail::vector_type_code<T>::value)
+		throw std::invalid_argument("Vector type mismatch.");
+
+	Vector<T, 2> vector;
+	vector[0] = *static_cast<T const*>(crVector.pX);
+	vector[1] = *static_cast<T const*>(crVector.pY);
+
+	return vector;
+}
+
+#endif /* __VECTOR_HPP_INCLUDED__ */
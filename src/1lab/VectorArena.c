@@ -0,0 +1,169 @@
+// This is a personal academic project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+#include "VectorArena.h"
+#include "VectorStats.h"
+
+/// [url] https://en.cppreference.com/w/cpp/header/cstdlib [/url]
+#include <stdlib.h>
+/// [url] https://en.cppreference.com/w/cpp/header/cstdint [/url]
+#include <stdint.h>
+
+#ifdef _MSC_VER
+#define VECTOR_THREAD_LOCAL __declspec(thread)
+#else
+#define VECTOR_THREAD_LOCAL _Thread_local
+#endif /* _MSC_VER */
+
+///====================================================================================================================================
+/// <summary>   Memory block of the arena. Data follows the header. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+
+typedef struct _ArenaBlock
+{
+	struct _ArenaBlock* pNext;
+	size_t              cb;
+} ARENA_BLOCK;
+
+struct _VectorArena
+{
+	ARENA_BLOCK* pFirst;
+	ARENA_BLOCK* pCurrent;
+	uintptr_t    cursor;
+	uintptr_t    end;
+	size_t       cbBlock;
+};
+
+static VECTOR_THREAD_LOCAL PVECTOR_ARENA s_pThreadArena = NULL;
+
+///====================================================================================================================================
+/// <summary>   Allocates block with cb bytes of data. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="cb">	Size of the data. </param>
+///
+/// <returns>	New block or NULL. </returns>
+///====================================================================================================================================
+static ARENA_BLOCK* CreateBlock(size_t cb)
+{
+	ARENA_BLOCK* pBlock = (ARENA_BLOCK*)malloc(sizeof(ARENA_BLOCK) + cb);
+	if (!pBlock)
+		return NULL;
+
+	VECTOR_STATS_ALLOC(sizeof(ARENA_BLOCK) + cb);
+
+	pBlock->pNext = NULL;
+	pBlock->cb    = cb;
+
+	return pBlock;
+}
+
+///====================================================================================================================================
+/// <summary>   Makes block current. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="pArena">	Arena. </param>
+/// <param name="pBlock">	Block of the arena. </param>
+///====================================================================================================================================
+static void UseBlock(PVECTOR_ARENA pArena, ARENA_BLOCK* pBlock)
+{
+	pArena->pCurrent = pBlock;
+	pArena->cursor   = (uintptr_t)(pBlock + 1);
+	pArena->end      = pArena->cursor + pBlock->cb;
+}
+
+PVECTOR_ARENA CreateVectorArena(size_t cbBlock)
+{
+	VECTOR_ARENA* pArena = (VECTOR_ARENA*)calloc(1, sizeof(VECTOR_ARENA));
+	if (!pArena)
+		return NULL;
+
+	VECTOR_STATS_ALLOC(sizeof(VECTOR_ARENA));
+
+	pArena->cbBlock = cbBlock ? cbBlock : VECTOR_ARENA_BLOCK_SIZE;
+	pArena->pFirst  = CreateBlock(pArena->cbBlock);
+	if (!pArena->pFirst)
+	{
+		VECTOR_STATS_FREE(sizeof(VECTOR_ARENA));
+		free(pArena);
+
+		return NULL;
+	}
+
+	UseBlock(pArena, pArena->pFirst);
+
+	return pArena;
+}
+
+void DeleteVectorArena(PVECTOR_ARENA pArena)
+{
+	if (pArena)
+	{
+		for (ARENA_BLOCK* pBlock = pArena->pFirst; pBlock; )
+		{
+			ARENA_BLOCK* pNext = pBlock->pNext;
+			VECTOR_STATS_FREE(sizeof(ARENA_BLOCK) + pBlock->cb);
+			free(pBlock);
+			pBlock = pNext;
+		}
+
+		VECTOR_STATS_FREE(sizeof(VECTOR_ARENA));
+		free(pArena);
+		pArena = NULL;
+	}
+}
+
+void ResetVectorArena(PVECTOR_ARENA pArena)
+{
+	UseBlock(pArena, pArena->pFirst);
+}
+
+void* ArenaAlloc(PVECTOR_ARENA pArena, size_t cb, size_t alignment)
+{
+	for (;;)
+	{
+		const uintptr_t aligned = (pArena->cursor + alignment - 1) & ~(uintptr_t)(alignment - 1);
+		if (aligned <= pArena->end && cb <= pArena->end - aligned)
+		{
+			pArena->cursor = aligned + cb;
+
+			return (void*)aligned;
+		}
+
+		// Blocks kept by ResetVectorArena are reused first, oversized requests get a block of their own
+		ARENA_BLOCK* pNext = pArena->pCurrent->pNext;
+		if (!pNext || pNext->cb < cb + alignment)
+		{
+			const size_t cbNeeded = cb + alignment;
+			if (cbNeeded < cb)
+				return NULL;
+
+			pNext = CreateBlock(cbNeeded > pArena->cbBlock ? cbNeeded : pArena->cbBlock);
+			if (!pNext)
+				return NULL;
+
+			pNext->pNext            = pArena->pCurrent->pNext;
+			pArena->pCurrent->pNext = pNext;
+		}
+
+		UseBlock(pArena, pNext);
+	}
+}
+
+PVECTOR_ARENA GetThreadVectorArena(void)
+{
+	if (!s_pThreadArena)
+		s_pThreadArena = CreateVectorArena(0);
+
+	return s_pThreadArena;
+}
+
+void ReleaseThreadVectorArena(void)
+{
+	DeleteVectorArena(s_pThreadArena);
+	s_pThreadArena = NULL;
+}
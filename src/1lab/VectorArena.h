@@ -0,0 +1,104 @@
+#pragma once
+
+///====================================================================================================================================
+/// File:				VectorArena.h
+/// Author:				MyLibh
+/// Created:			17.10.2026
+///
+/// Last modified by:	MyLibh
+/// Last modified on:	17.10.2026
+///====================================================================================================================================
+/// Copyright(c) MyLibh. All rights reserved.
+///====================================================================================================================================
+
+#ifndef __VECTORARENA_H_INCLUDED__
+#define __VECTORARENA_H_INCLUDED__
+
+#include "Vector.h"
+
+/// [url] https://en.cppreference.com/w/c/types/size_t [/url]
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+///====================================================================================================================================
+/// <summary>   Default size of an arena block. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+#define VECTOR_ARENA_BLOCK_SIZE (64 * 1024)
+
+///====================================================================================================================================
+/// <summary>   Alignment of the memory returned by ArenaAlloc, enough for any component type. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+#define VECTOR_ARENA_ALIGNMENT 16
+
+///====================================================================================================================================
+/// <summary>   Creates arena. </summary>
+///
+/// <remarks>
+/// 	MyLibh, 17.10.2026. An arena is not synchronized, every thread has to use its own one (see GetThreadVectorArena).
+/// </remarks>
+///
+/// <param name="cbBlock"> Size of the memory blocks the arena grows by, 0 for VECTOR_ARENA_BLOCK_SIZE. </param>
+///
+/// <returns>	New arena or NULL. </returns>
+///====================================================================================================================================
+PVECTOR_ARENA CreateVectorArena(size_t cbBlock);
+
+///====================================================================================================================================
+/// <summary>   Deletes arena and all vectors allocated from it. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="pArena"> Arena for deleting. </param>
+///====================================================================================================================================
+void DeleteVectorArena(PVECTOR_ARENA pArena);
+
+///====================================================================================================================================
+/// <summary>   Releases all vectors allocated from the arena in O(1). The memory is kept for the next allocations. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="pArena"> Arena. </param>
+///====================================================================================================================================
+void ResetVectorArena(PVECTOR_ARENA pArena);
+
+///====================================================================================================================================
+/// <summary>   Allocates memory from the arena. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="pArena">		Arena. </param>
+/// <param name="cb">			Size in bytes. </param>
+/// <param name="alignment">	Power of two alignment. </param>
+///
+/// <returns>	Uninitialized memory valid until the arena is reset or deleted, or NULL. </returns>
+///====================================================================================================================================
+void* ArenaAlloc(PVECTOR_ARENA pArena, size_t cb, size_t alignment);
+
+///====================================================================================================================================
+/// <summary>   Gets arena of the calling thread, creating it on the first call. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <returns>	Arena or NULL. </returns>
+///====================================================================================================================================
+PVECTOR_ARENA GetThreadVectorArena(void);
+
+///====================================================================================================================================
+/// <summary>   Deletes arena of the calling thread. Has to be called before the thread exits. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+void ReleaseThreadVectorArena(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __VECTORARENA_H_INCLUDED__ */
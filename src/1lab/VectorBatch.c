@@ -0,0 +1,250 @@
+// This is a personal academic project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+#include "VectorBatch.h"
+#include "VectorKernels.h"
+#include "VectorFile.h"
+#include "VectorStats.h"
+
+/// [url] https://en.cppreference.com/w/cpp/header/cstdlib [/url]
+#include <stdlib.h>
+/// [url] https://en.cppreference.com/w/cpp/header/cstring [/url]
+#include <string.h>
+/// [url] https://en.cppreference.com/w/cpp/header/cassert [/url]
+#include <assert.h>
+#ifdef _MSC_VER
+/// [url] https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/aligned-malloc?view=vs-2019 [/url]
+#include <malloc.h>
+#endif /* _MSC_VER */
+
+///====================================================================================================================================
+/// <summary>   Allocates memory aligned to VECTOR_BATCH_ALIGNMENT. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="cb">	Size in bytes. </param>
+///
+/// <returns>	Pointer to the allocated memory or NULL. </returns>
+///====================================================================================================================================
+static void* AllocAligned(size_t cb)
+{
+	cb = (cb + VECTOR_BATCH_ALIGNMENT - 1) / VECTOR_BATCH_ALIGNMENT * VECTOR_BATCH_ALIGNMENT;
+
+#ifdef _MSC_VER
+	void* p = _aligned_malloc(cb, VECTOR_BATCH_ALIGNMENT);
+#else
+	void* p = aligned_alloc(VECTOR_BATCH_ALIGNMENT, cb);
+#endif /* _MSC_VER */
+	if (p)
+		VECTOR_STATS_ALLOC(cb);
+
+	return p;
+}
+
+///====================================================================================================================================
+/// <summary>   Frees memory allocated by AllocAligned. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="p">	Pointer to the memory. </param>
+/// <param name="cb">	Size in bytes passed to AllocAligned. </param>
+///====================================================================================================================================
+static void FreeAligned(void* p, size_t cb)
+{
+	(void)cb;
+	if (p)
+		VECTOR_STATS_FREE((cb + VECTOR_BATCH_ALIGNMENT - 1) / VECTOR_BATCH_ALIGNMENT * VECTOR_BATCH_ALIGNMENT);
+
+#ifdef _MSC_VER
+	_aligned_free(p);
+#else
+	free(p);
+#endif /* _MSC_VER */
+}
+
+///====================================================================================================================================
+/// <summary>   Frees components of the batch. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="pBatch">	Batch. </param>
+///====================================================================================================================================
+static void FreeComponents(PVECTOR_BATCH pBatch)
+{
+	if (pBatch->pMapping)
+	{
+		ReleaseVectorFileMapping(pBatch->pMapping);
+		pBatch->pMapping = NULL;
+	}
+	else
+	{
+		const size_t cb = pBatch->capacity * GetComponentSize(pBatch->type);
+		FreeAligned(pBatch->pX, cb);
+		FreeAligned(pBatch->pY, cb);
+	}
+
+	pBatch->pX = NULL;
+	pBatch->pY = NULL;
+}
+
+PVECTOR_BATCH CreateVectorBatch(int type, size_t capacity)
+{
+	if (!GetComponentSize(type))
+		return NULL;
+
+	VECTOR_BATCH* pBatch = (VECTOR_BATCH*)calloc(1, sizeof(VECTOR_BATCH));
+	if (!pBatch)
+		return NULL;
+
+	VECTOR_STATS_ALLOC(sizeof(VECTOR_BATCH));
+
+	pBatch->type = type;
+
+	if (capacity && ReserveVectorBatch(pBatch, capacity) != VECTOR_OK)
+	{
+		DeleteVectorBatch(pBatch);
+
+		return NULL;
+	}
+
+	return pBatch;
+}
+
+void DeleteVectorBatch(PVECTOR_BATCH pBatch)
+{
+	if (pBatch)
+	{
+		FreeComponents(pBatch);
+
+		VECTOR_STATS_FREE(sizeof(VECTOR_BATCH));
+		free(pBatch);
+		pBatch = NULL;
+	}
+}
+
+int ReserveVectorBatch(PVECTOR_BATCH pBatch, size_t capacity)
+{
+	if (!pBatch)
+		return VECTOR_E_INVALID_ARG;
+
+	if (capacity <= pBatch->capacity)
+		return VECTOR_OK;
+
+	const size_t cbComponent = GetComponentSize(pBatch->type);
+	if (capacity > (size_t)-1 / cbComponent)
+		return VECTOR_E_NO_MEMORY;
+
+	void* pX = AllocAligned(capacity * cbComponent);
+	void* pY = AllocAligned(capacity * cbComponent);
+	if (!pX || !pY)
+	{
+		FreeAligned(pX, capacity * cbComponent);
+		FreeAligned(pY, capacity * cbComponent);
+
+		return VECTOR_E_NO_MEMORY;
+	}
+
+	if (pBatch->size)
+	{
+		memcpy(pX, pBatch->pX, pBatch->size * cbComponent);
+		memcpy(pY, pBatch->pY, pBatch->size * cbComponent);
+	}
+
+	// A mapped batch moves to the heap here
+	FreeComponents(pBatch);
+
+	pBatch->pX       = pX;
+	pBatch->pY       = pY;
+	pBatch->capacity = capacity;
+
+	return VECTOR_OK;
+}
+
+int PushBackComponents(PVECTOR_BATCH pBatch, void const* cpX, void const* cpY)
+{
+	if (!pBatch || !cpX || !cpY)
+		return VECTOR_E_INVALID_ARG;
+
+	if (pBatch->size == pBatch->capacity)
+	{
+		const int status = ReserveVectorBatch(pBatch, pBatch->capacity ? 2 * pBatch->capacity : 16);
+		if (status != VECTOR_OK)
+			return status;
+	}
+
+	const size_t cbComponent = GetComponentSize(pBatch->type);
+	memcpy((char*)pBatch->pX + pBatch->size * cbComponent, cpX, cbComponent);
+	memcpy((char*)pBatch->pY + pBatch->size * cbComponent, cpY, cbComponent);
+
+	pBatch->size++;
+
+	return VECTOR_OK;
+}
+
+int PushBackVector(PVECTOR_BATCH pBatch, const PVECTOR cpVector)
+{
+	if (!pBatch || !cpVector)
+		return VECTOR_E_INVALID_ARG;
+
+	if (pBatch->type != cpVector->type)
+		return VECTOR_E_TYPE_MISMATCH;
+
+	return PushBackComponents(pBatch, cpVector->pX, cpVector->pY);
+}
+
+PVECTOR GetBatchVector(const PVECTOR_BATCH cpBatch, size_t index)
+{
+	if (index >= cpBatch->size)
+		return NULL;
+
+	const size_t cbComponent = GetComponentSize(cpBatch->type);
+
+	return CreateVector(cpBatch->type, (char const*)cpBatch->pX + index * cbComponent, (char const*)cpBatch->pY + index * cbComponent);
+}
+
+PVECTOR_BATCH BatchSum(const PVECTOR_BATCH cpLHB, const PVECTOR_BATCH cpRHB)
+{
+	assert(cpLHB->type == cpRHB->type);
+	assert(cpLHB->size == cpRHB->size);
+
+	if (cpLHB->type != cpRHB->type || cpLHB->size != cpRHB->size)
+		return NULL;
+
+	PVECTOR_BATCH pResult = CreateVectorBatch(cpLHB->type, cpLHB->size);
+	if (!pResult)
+		return NULL;
+
+	const PFN_ADD_KERNEL pfnAdd = GetVectorKernels()->pfnAdd[cpLHB->type];
+	pfnAdd(pResult->pX, cpLHB->pX, cpRHB->pX, cpLHB->size);
+	pfnAdd(pResult->pY, cpLHB->pY, cpRHB->pY, cpLHB->size);
+
+	pResult->size = cpLHB->size;
+
+	return pResult;
+}
+
+int BatchScalarProduct(const PVECTOR_BATCH cpLHB, const PVECTOR_BATCH cpRHB, void* pResults)
+{
+	if (!cpLHB || !cpRHB || !pResults)
+		return VECTOR_E_INVALID_ARG;
+
+	if (cpLHB->type != cpRHB->type || cpLHB->size != cpRHB->size)
+		return VECTOR_E_TYPE_MISMATCH;
+
+	GetVectorKernels()->pfnScalarProduct[cpLHB->type](pResults, cpLHB->pX, cpLHB->pY, cpRHB->pX, cpRHB->pY, cpLHB->size);
+
+	return VECTOR_OK;
+}
+
+int BatchDotProduct(const PVECTOR_BATCH cpLHB, const PVECTOR_BATCH cpRHB, REAL* pResult)
+{
+	if (!cpLHB || !cpRHB || !pResult)
+		return VECTOR_E_INVALID_ARG;
+
+	if (cpLHB->type != cpRHB->type || cpLHB->size != cpRHB->size)
+		return VECTOR_E_TYPE_MISMATCH;
+
+	*pResult = GetVectorKernels()->pfnDotProduct[cpLHB->type](cpLHB->pX, cpLHB->pY, cpRHB->pX, cpRHB->pY, cpLHB->size);
+
+	return VECTOR_OK;
+}
@@ -0,0 +1,184 @@
+#pragma once
+
+///====================================================================================================================================
+/// File:				VectorBatch.h
+/// Author:				MyLibh
+/// Created:			17.10.2026
+///
+/// Last modified by:	MyLibh
+/// Last modified on:	17.10.2026
+///====================================================================================================================================
+/// Copyright(c) MyLibh. All rights reserved.
+///====================================================================================================================================
+
+#ifndef __VECTORBATCH_H_INCLUDED__
+#define __VECTORBATCH_H_INCLUDED__
+
+#include "Vector.h"
+
+/// [url] https://en.cppreference.com/w/c/types/size_t [/url]
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+///====================================================================================================================================
+/// <summary>   Alignment of the component arrays of a batch. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+#define VECTOR_BATCH_ALIGNMENT 64
+
+///====================================================================================================================================
+/// <summary>   A set of two-dimensional vectors of the same type stored as structure of arrays. </summary>
+///
+/// <remarks>
+/// 	MyLibh, 17.10.2026. pMapping is set for batches mapped by MapVectorFile, their components live in the copy-on-write view of
+/// 	the file until the batch grows.
+/// </remarks>
+///====================================================================================================================================
+
+typedef struct _VectorBatch
+{
+	int    type;
+	size_t size;
+	size_t capacity;
+	void*  pX;
+	void*  pY;
+	void*  pMapping;
+} VECTOR_BATCH, *PVECTOR_BATCH;
+
+///====================================================================================================================================
+/// <summary>   Macro for x-component of the i-th vector in the batch. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+#define BATCH_X(batch, type, i) (((type*)(batch->pX))[i])
+
+///====================================================================================================================================
+/// <summary>   Macro for y-component of the i-th vector in the batch. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+#define BATCH_Y(batch, type, i) (((type*)(batch->pY))[i])
+
+///====================================================================================================================================
+/// <summary>   Creates empty batch. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="type">		Type of vector components. </param>
+/// <param name="capacity">	Number of vectors to reserve storage for. </param>
+///
+/// <returns>	New batch or NULL. </returns>
+///====================================================================================================================================
+PVECTOR_BATCH CreateVectorBatch(int type, size_t capacity);
+
+///====================================================================================================================================
+/// <summary>   Deletes batch. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="pBatch"> Batch for deleting. </param>
+///====================================================================================================================================
+void DeleteVectorBatch(PVECTOR_BATCH pBatch);
+
+///====================================================================================================================================
+/// <summary>   Reserves storage for at least capacity vectors. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="pBatch">	Batch. </param>
+/// <param name="capacity">	Required capacity. </param>
+///
+/// <returns>	VECTOR_OK or error code. </returns>
+///====================================================================================================================================
+int ReserveVectorBatch(PVECTOR_BATCH pBatch, size_t capacity);
+
+///====================================================================================================================================
+/// <summary>   Appends vector with the given components to the batch. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="pBatch">	Batch. </param>
+/// <param name="cpX">		Value for x-component. </param>
+/// <param name="cpY">		Value for y-component. </param>
+///
+/// <returns>	VECTOR_OK or error code. </returns>
+///====================================================================================================================================
+int PushBackComponents(PVECTOR_BATCH pBatch, void const* cpX, void const* cpY);
+
+///====================================================================================================================================
+/// <summary>   Appends copy of the vector to the batch. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="pBatch">	Batch. </param>
+/// <param name="cpVector">	Vector of the same type as the batch. </param>
+///
+/// <returns>	VECTOR_OK or error code. </returns>
+///====================================================================================================================================
+int PushBackVector(PVECTOR_BATCH pBatch, const PVECTOR cpVector);
+
+///====================================================================================================================================
+/// <summary>   Creates standalone copy of the vector stored in the batch. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. VECTOR_FLOAT and VECTOR_DOUBLE batches have no VECTOR counterpart. </remarks>
+///
+/// <param name="cpBatch">	Batch. </param>
+/// <param name="index">	Index of the vector. </param>
+///
+/// <returns>	New vector or NULL. </returns>
+///====================================================================================================================================
+PVECTOR GetBatchVector(const PVECTOR_BATCH cpBatch, size_t index);
+
+///====================================================================================================================================
+/// <summary>   Calculates sums of the corresponding vectors of two batches. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="cpLHB"> Batch. </param>
+/// <param name="cpRHB"> Batch of the same type and size. </param>
+///
+/// <returns>	New batch with the element-wise sums or NULL. </returns>
+///====================================================================================================================================
+PVECTOR_BATCH BatchSum(const PVECTOR_BATCH cpLHB, const PVECTOR_BATCH cpRHB);
+
+///====================================================================================================================================
+/// <summary>   Calculates scalar products of the corresponding vectors of two batches. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="cpLHB">	Batch. </param>
+/// <param name="cpRHB">	Batch of the same type and size. </param>
+/// <param name="pResults">
+/// 	Array of at least cpLHB->size elements receiving the products. Elements are REAL for VECTOR_INTEGRAL, VECTOR_REAL and
+/// 	VECTOR_COMPLEX batches, FLOAT and DOUBLE for VECTOR_FLOAT and VECTOR_DOUBLE ones.
+/// </param>
+///
+/// <returns>	VECTOR_OK or error code. </returns>
+///====================================================================================================================================
+int BatchScalarProduct(const PVECTOR_BATCH cpLHB, const PVECTOR_BATCH cpRHB, void* pResults);
+
+///====================================================================================================================================
+/// <summary>   Calculates sum of the scalar products of the corresponding vectors of two batches. </summary>
+///
+/// <remarks>
+/// 	MyLibh, 17.10.2026. VECTOR_FLOAT and VECTOR_DOUBLE sums are rounded in an order that depends on the instruction set chosen by
+/// 	GetVectorKernels.
+/// </remarks>
+///
+/// <param name="cpLHB">	Batch. </param>
+/// <param name="cpRHB">	Batch of the same type and size. </param>
+/// <param name="pResult">	Sum of the scalar products. </param>
+///
+/// <returns>	VECTOR_OK or error code. </returns>
+///====================================================================================================================================
+int BatchDotProduct(const PVECTOR_BATCH cpLHB, const PVECTOR_BATCH cpRHB, REAL* pResult);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __VECTORBATCH_H_INCLUDED__ */
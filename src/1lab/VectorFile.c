@@ -0,0 +1,270 @@
+// This is a personal academic project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+#include "VectorFile.h"
+#include "VectorStats.h"
+
+/// [url] https://en.cppreference.com/w/cpp/header/cstdio [/url]
+#include <stdio.h>
+/// [url] https://en.cppreference.com/w/cpp/header/cstdlib [/url]
+#include <stdlib.h>
+/// [url] https://en.cppreference.com/w/cpp/header/cstring [/url]
+#include <string.h>
+
+#ifdef _WIN32
+/// [url] https://docs.microsoft.com/en-us/windows/win32/memory/file-mapping [/url]
+#include <windows.h>
+#else
+/// [url] https://pubs.opengroup.org/onlinepubs/9699919799/functions/mmap.html [/url]
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif /* _WIN32 */
+
+typedef struct _VectorFileMapping
+{
+	void*  pView;
+	size_t cb;
+} VECTOR_FILE_MAPPING;
+
+static uint64_t AlignOffset(uint64_t offset)
+{
+	return (offset + VECTOR_FILE_ALIGNMENT - 1) / VECTOR_FILE_ALIGNMENT * VECTOR_FILE_ALIGNMENT;
+}
+
+///====================================================================================================================================
+/// <summary>   Writes zero bytes up to the next aligned offset. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="pFile">	File. </param>
+/// <param name="offset">	Current offset. </param>
+///
+/// <returns>	Non-zero if succeeded, 0 otherwise. </returns>
+///====================================================================================================================================
+static int WritePadding(FILE* pFile, uint64_t offset)
+{
+	static const char SC_ZEROS[VECTOR_FILE_ALIGNMENT] = { 0 };
+
+	const size_t cb = (size_t)(AlignOffset(offset) - offset);
+
+	return fwrite(SC_ZEROS, 1, cb, pFile) == cb;
+}
+
+int WriteVectorFile(const char* cpPath, const PVECTOR_BATCH cpBatch)
+{
+	if (!cpPath || !cpBatch)
+		return VECTOR_E_INVALID_ARG;
+
+	const size_t cbComponent = GetComponentSize(cpBatch->type);
+	if (!cbComponent)
+		return VECTOR_E_UNKNOWN_TYPE;
+
+	const uint64_t cbArray = (uint64_t)cpBatch->size * cbComponent;
+
+	VECTOR_FILE_HEADER header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, VECTOR_FILE_MAGIC, sizeof(header.magic));
+	header.version       = VECTOR_FILE_VERSION;
+	header.byteOrder     = VECTOR_FILE_BYTE_ORDER;
+	header.type          = (uint32_t)cpBatch->type;
+	header.componentSize = (uint32_t)cbComponent;
+	header.count         = cpBatch->size;
+	header.offsetX       = AlignOffset(sizeof(header));
+	header.offsetY       = AlignOffset(header.offsetX + cbArray);
+
+	FILE* pFile = NULL;
+#ifdef _MSC_VER
+	if (fopen_s(&pFile, cpPath, "wb"))
+		pFile = NULL;
+#else
+	pFile = fopen(cpPath, "wb");
+#endif /* _MSC_VER */
+	if (!pFile)
+		return VECTOR_E_IO;
+
+	int succeeded = fwrite(&header, sizeof(header), 1, pFile) == 1 && WritePadding(pFile, sizeof(header));
+	if (succeeded && cpBatch->size)
+		succeeded = fwrite(cpBatch->pX, cbComponent, cpBatch->size, pFile) == cpBatch->size &&
+		            WritePadding(pFile, header.offsetX + cbArray) &&
+		            fwrite(cpBatch->pY, cbComponent, cpBatch->size, pFile) == cpBatch->size;
+
+	return fclose(pFile) == 0 && succeeded ? VECTOR_OK : VECTOR_E_IO;
+}
+
+///====================================================================================================================================
+/// <summary>   Maps the whole file copy-on-write. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="cpPath">	Path to the file. </param>
+/// <param name="pMapping">	Mapping. </param>
+///
+/// <returns>	VECTOR_OK or error code. </returns>
+///====================================================================================================================================
+static int MapFile(const char* cpPath, VECTOR_FILE_MAPPING* pMapping)
+{
+#ifdef _WIN32
+	HANDLE hFile = CreateFileA(cpPath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (hFile == INVALID_HANDLE_VALUE)
+		return VECTOR_E_IO;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(hFile, &size))
+	{
+		CloseHandle(hFile);
+
+		return VECTOR_E_IO;
+	}
+
+	if ((ULONGLONG)size.QuadPart < sizeof(VECTOR_FILE_HEADER) || (ULONGLONG)size.QuadPart > (SIZE_T)-1)
+	{
+		CloseHandle(hFile);
+
+		return VECTOR_E_BAD_FORMAT;
+	}
+
+	// The view keeps the file open, so both handles can be closed right away
+	HANDLE hMapping = CreateFileMappingA(hFile, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+	CloseHandle(hFile);
+	if (!hMapping)
+		return VECTOR_E_IO;
+
+	pMapping->pView = MapViewOfFile(hMapping, FILE_MAP_COPY, 0, 0, 0);
+	pMapping->cb    = (size_t)size.QuadPart;
+	CloseHandle(hMapping);
+
+	return pMapping->pView ? VECTOR_OK : VECTOR_E_IO;
+#else
+	const int fd = open(cpPath, O_RDONLY);
+	if (fd < 0)
+		return VECTOR_E_IO;
+
+	struct stat info;
+	if (fstat(fd, &info))
+	{
+		close(fd);
+
+		return VECTOR_E_IO;
+	}
+
+	if ((uint64_t)info.st_size < sizeof(VECTOR_FILE_HEADER) || (uint64_t)info.st_size > (size_t)-1)
+	{
+		close(fd);
+
+		return VECTOR_E_BAD_FORMAT;
+	}
+
+	pMapping->cb    = (size_t)info.st_size;
+	pMapping->pView = mmap(NULL, pMapping->cb, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (pMapping->pView == MAP_FAILED)
+	{
+		pMapping->pView = NULL;
+
+		return VECTOR_E_IO;
+	}
+
+	return VECTOR_OK;
+#endif /* _WIN32 */
+}
+
+static void UnmapFile(VECTOR_FILE_MAPPING* pMapping)
+{
+#ifdef _WIN32
+	UnmapViewOfFile(pMapping->pView);
+#else
+	munmap(pMapping->pView, pMapping->cb);
+#endif /* _WIN32 */
+}
+
+///====================================================================================================================================
+/// <summary>   Checks the header against this build and the size of the file. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="cpHeader">	Header. </param>
+/// <param name="cbFile">	Size of the file. </param>
+///
+/// <returns>	VECTOR_OK or VECTOR_E_BAD_FORMAT. </returns>
+///====================================================================================================================================
+static int CheckHeader(const VECTOR_FILE_HEADER* cpHeader, size_t cbFile)
+{
+	if (memcmp(cpHeader->magic, VECTOR_FILE_MAGIC, sizeof(cpHeader->magic)) || cpHeader->version != VECTOR_FILE_VERSION ||
+	    cpHeader->byteOrder != VECTOR_FILE_BYTE_ORDER)
+		return VECTOR_E_BAD_FORMAT;
+
+	if (cpHeader->type >= VECTOR_TYPE_COUNT || cpHeader->componentSize != GetComponentSize((int)cpHeader->type))
+		return VECTOR_E_BAD_FORMAT;
+
+	if (cpHeader->offsetX % VECTOR_FILE_ALIGNMENT || cpHeader->offsetY % VECTOR_FILE_ALIGNMENT ||
+	    cpHeader->offsetX < sizeof(VECTOR_FILE_HEADER) || cpHeader->offsetX > cbFile || cpHeader->offsetY > cbFile)
+		return VECTOR_E_BAD_FORMAT;
+
+	if (cpHeader->count > (uint64_t)(cbFile - cpHeader->offsetX) / cpHeader->componentSize ||
+	    cpHeader->count > (uint64_t)(cbFile - cpHeader->offsetY) / cpHeader->componentSize)
+		return VECTOR_E_BAD_FORMAT;
+
+	return VECTOR_OK;
+}
+
+PVECTOR_BATCH MapVectorFile(const char* cpPath, int* pStatus)
+{
+	int status = VECTOR_E_INVALID_ARG;
+
+	VECTOR_FILE_MAPPING* pMapping = NULL;
+	VECTOR_BATCH*        pBatch   = NULL;
+	if (cpPath)
+	{
+		pMapping = (VECTOR_FILE_MAPPING*)calloc(1, sizeof(VECTOR_FILE_MAPPING));
+		pBatch   = (VECTOR_BATCH*)calloc(1, sizeof(VECTOR_BATCH));
+		status   = pMapping && pBatch ? MapFile(cpPath, pMapping) : VECTOR_E_NO_MEMORY;
+		if (status == VECTOR_OK)
+		{
+			const VECTOR_FILE_HEADER* cpHeader = (const VECTOR_FILE_HEADER*)pMapping->pView;
+
+			status = CheckHeader(cpHeader, pMapping->cb);
+			if (status == VECTOR_OK)
+			{
+				pBatch->type     = (int)cpHeader->type;
+				pBatch->size     = (size_t)cpHeader->count;
+				pBatch->capacity = pBatch->size;
+				pBatch->pX       = (char*)pMapping->pView + cpHeader->offsetX;
+				pBatch->pY       = (char*)pMapping->pView + cpHeader->offsetY;
+				pBatch->pMapping = pMapping;
+
+				// Counted once the batch is complete, DeleteVectorBatch and ReleaseVectorFileMapping balance them. The view isn't heap
+				VECTOR_STATS_ALLOC(sizeof(VECTOR_FILE_MAPPING));
+				VECTOR_STATS_ALLOC(sizeof(VECTOR_BATCH));
+			}
+			else
+				UnmapFile(pMapping);
+		}
+	}
+
+	if (pStatus)
+		*pStatus = status;
+
+	if (status != VECTOR_OK)
+	{
+		free(pMapping);
+		free(pBatch);
+
+		return NULL;
+	}
+
+	return pBatch;
+}
+
+void ReleaseVectorFileMapping(void* pMapping)
+{
+	if (pMapping)
+	{
+		VECTOR_STATS_FREE(sizeof(VECTOR_FILE_MAPPING));
+
+		UnmapFile((VECTOR_FILE_MAPPING*)pMapping);
+		free(pMapping);
+		pMapping = NULL;
+	}
+}
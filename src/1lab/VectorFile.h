@@ -0,0 +1,100 @@
+#pragma once
+
+///====================================================================================================================================
+/// File:				VectorFile.h
+/// Author:				MyLibh
+/// Created:			17.10.2026
+///
+/// Last modified by:	MyLibh
+/// Last modified on:	17.10.2026
+///====================================================================================================================================
+/// Copyright(c) MyLibh. All rights reserved.
+///====================================================================================================================================
+
+#ifndef __VECTORFILE_H_INCLUDED__
+#define __VECTORFILE_H_INCLUDED__
+
+#include "VectorBatch.h"
+
+/// [url] https://en.cppreference.com/w/c/types/integer [/url]
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#define VECTOR_FILE_MAGIC      "VECB"
+#define VECTOR_FILE_VERSION    0x1
+#define VECTOR_FILE_BYTE_ORDER 0x01020304u
+
+///====================================================================================================================================
+/// <summary>   Alignment of the component arrays in the file, so a mapped batch is as aligned as an allocated one. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+#define VECTOR_FILE_ALIGNMENT VECTOR_BATCH_ALIGNMENT
+
+///====================================================================================================================================
+/// <summary>   Header at the beginning of a vector file. The x-components start at offsetX, the y-components at offsetY. </summary>
+///
+/// <remarks>
+/// 	MyLibh, 17.10.2026. Fields are stored in the byte order of the writer. byteOrder and componentSize let the reader reject files
+/// 	from a machine with other byte order or REAL layout instead of misreading them.
+/// </remarks>
+///====================================================================================================================================
+
+typedef struct _VectorFileHeader
+{
+	char     magic[4];
+	uint32_t version;
+	uint32_t byteOrder;
+	uint32_t type;
+	uint32_t componentSize;
+	uint32_t reserved0;
+	uint64_t count;
+	uint64_t offsetX;
+	uint64_t offsetY;
+	uint8_t  reserved[16];
+} VECTOR_FILE_HEADER;
+
+///====================================================================================================================================
+/// <summary>   Writes batch to the file. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="cpPath">	Path to the file. </param>
+/// <param name="cpBatch">	Batch. </param>
+///
+/// <returns>	VECTOR_OK or error code. </returns>
+///====================================================================================================================================
+int WriteVectorFile(const char* cpPath, const PVECTOR_BATCH cpBatch);
+
+///====================================================================================================================================
+/// <summary>   Maps the file written by WriteVectorFile and exposes its components as a batch without copying. </summary>
+///
+/// <remarks>
+/// 	MyLibh, 17.10.2026. The view is copy-on-write, changes of the batch never reach the file. Growing the batch moves it to the
+/// 	heap. DeleteVectorBatch unmaps the file.
+/// </remarks>
+///
+/// <param name="cpPath">	Path to the file. </param>
+/// <param name="pStatus">	VECTOR_OK or error code, may be NULL. </param>
+///
+/// <returns>	New batch or NULL. </returns>
+///====================================================================================================================================
+PVECTOR_BATCH MapVectorFile(const char* cpPath, int* pStatus);
+
+///====================================================================================================================================
+/// <summary>   Unmaps the view of the batch mapped by MapVectorFile. Used by VectorBatch. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="pMapping">	Mapping of the batch. </param>
+///====================================================================================================================================
+void ReleaseVectorFileMapping(void* pMapping);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __VECTORFILE_H_INCLUDED__ */
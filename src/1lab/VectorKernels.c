@@ -0,0 +1,747 @@
+// This is a personal academic project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+#include "VectorKernels.h"
+
+/// [url] https://en.cppreference.com/w/cpp/header/ctgmath [/url]
+#include <tgmath.h>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define VECTOR_X86
+
+/// [url] https://software.intel.com/sites/landingpage/IntrinsicsGuide/ [/url]
+#include <immintrin.h>
+#ifdef _MSC_VER
+/// [url] https://docs.microsoft.com/en-us/cpp/intrinsics/cpuid-cpuidex?view=vs-2019 [/url]
+#include <intrin.h>
+#endif /* _MSC_VER */
+#endif /* x86 */
+
+// MSVC allows any intrinsic in any function, GCC and Clang have to be told which instruction set a function is compiled for
+#if defined(VECTOR_X86) && (defined(__GNUC__) || defined(__clang__))
+#define VECTOR_TARGET(isa) __attribute__((target(isa)))
+#else
+#define VECTOR_TARGET(isa)
+#endif /* VECTOR_X86 && (__GNUC__ || __clang__) */
+
+#ifdef _MSC_VER
+/// [url] https://docs.microsoft.com/en-us/cpp/intrinsics/interlockedcompareexchangepointer-intrinsic-functions?view=vs-2019 [/url]
+#include <intrin.h>
+#define LoadPointer(ppSrc)                        _InterlockedCompareExchangePointer((void* volatile*)(ppSrc), NULL, NULL)
+#define CompareExchangePointer(ppDst, pNew, pOld) _InterlockedCompareExchangePointer((void* volatile*)(ppDst), (void*)(pNew), (void*)(pOld))
+#else
+#define LoadPointer(ppSrc)                        __atomic_load_n(ppSrc, __ATOMIC_ACQUIRE)
+#define CompareExchangePointer(ppDst, pNew, pOld) __sync_val_compare_and_swap(ppDst, pOld, pNew)
+#endif /* _MSC_VER */
+
+///====================================================================================================================================
+/// Scalar kernels. The only ones for REAL and COMPLEX, since there is no SIMD support for long double.
+///====================================================================================================================================
+
+static void AddInt(void* pDst, void const* cpLHS, void const* cpRHS, size_t count)
+{
+	INT* const       pD  = (INT*)pDst;
+	INT const* const cpL = (INT const*)cpLHS;
+	INT const* const cpR = (INT const*)cpRHS;
+	// Signed overflow is undefined, the sum wraps around through unsigned like the SIMD lanes do
+	for (size_t i = 0; i < count; ++i)
+		pD[i] = (INT)((unsigned)cpL[i] + (unsigned)cpR[i]);
+}
+
+static void AddReal(void* pDst, void const* cpLHS, void const* cpRHS, size_t count)
+{
+	REAL* const       pD  = (REAL*)pDst;
+	REAL const* const cpL = (REAL const*)cpLHS;
+	REAL const* const cpR = (REAL const*)cpRHS;
+	for (size_t i = 0; i < count; ++i)
+		pD[i] = cpL[i] + cpR[i];
+}
+
+static void AddComplex(void* pDst, void const* cpLHS, void const* cpRHS, size_t count)
+{
+	COMPLEX* const       pD  = (COMPLEX*)pDst;
+	COMPLEX const* const cpL = (COMPLEX const*)cpLHS;
+	COMPLEX const* const cpR = (COMPLEX const*)cpRHS;
+	for (size_t i = 0; i < count; ++i)
+		pD[i] = _LCOMPLEX_(creall(cpL[i]) + creall(cpR[i]), cimagl(cpL[i]) + cimagl(cpR[i]));
+}
+
+static void AddFloat(void* pDst, void const* cpLHS, void const* cpRHS, size_t count)
+{
+	FLOAT* const       pD  = (FLOAT*)pDst;
+	FLOAT const* const cpL = (FLOAT const*)cpLHS;
+	FLOAT const* const cpR = (FLOAT const*)cpRHS;
+	for (size_t i = 0; i < count; ++i)
+		pD[i] = cpL[i] + cpR[i];
+}
+
+static void AddDouble(void* pDst, void const* cpLHS, void const* cpRHS, size_t count)
+{
+	DOUBLE* const       pD  = (DOUBLE*)pDst;
+	DOUBLE const* const cpL = (DOUBLE const*)cpLHS;
+	DOUBLE const* const cpR = (DOUBLE const*)cpRHS;
+	for (size_t i = 0; i < count; ++i)
+		pD[i] = cpL[i] + cpR[i];
+}
+
+static void ScalarProductInt(void* pDst, void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	REAL* const      pD   = (REAL*)pDst;
+	INT const* const cpLx = (INT const*)cpLX, * const cpLy = (INT const*)cpLY;
+	INT const* const cpRx = (INT const*)cpRX, * const cpRy = (INT const*)cpRY;
+	for (size_t i = 0; i < count; ++i)
+		pD[i] = (REAL)cpLx[i] * cpRx[i] + (REAL)cpLy[i] * cpRy[i];
+}
+
+static void ScalarProductReal(void* pDst, void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	REAL* const       pD   = (REAL*)pDst;
+	REAL const* const cpLx = (REAL const*)cpLX, * const cpLy = (REAL const*)cpLY;
+	REAL const* const cpRx = (REAL const*)cpRX, * const cpRy = (REAL const*)cpRY;
+	for (size_t i = 0; i < count; ++i)
+		pD[i] = cpLx[i] * cpRx[i] + cpLy[i] * cpRy[i];
+}
+
+static void ScalarProductComplex(void* pDst, void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	REAL* const          pD   = (REAL*)pDst;
+	COMPLEX const* const cpLx = (COMPLEX const*)cpLX, * const cpLy = (COMPLEX const*)cpLY;
+	COMPLEX const* const cpRx = (COMPLEX const*)cpRX, * const cpRy = (COMPLEX const*)cpRY;
+	for (size_t i = 0; i < count; ++i)
+		pD[i] = (REAL)(creall(_LCmulcc(cpLx[i], conjl(cpRx[i]))) + creall(_LCmulcc(cpLy[i], conjl(cpRy[i]))));
+}
+
+static void ScalarProductFloat(void* pDst, void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	FLOAT* const       pD   = (FLOAT*)pDst;
+	FLOAT const* const cpLx = (FLOAT const*)cpLX, * const cpLy = (FLOAT const*)cpLY;
+	FLOAT const* const cpRx = (FLOAT const*)cpRX, * const cpRy = (FLOAT const*)cpRY;
+	for (size_t i = 0; i < count; ++i)
+		pD[i] = cpLx[i] * cpRx[i] + cpLy[i] * cpRy[i];
+}
+
+static void ScalarProductDouble(void* pDst, void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	DOUBLE* const       pD   = (DOUBLE*)pDst;
+	DOUBLE const* const cpLx = (DOUBLE const*)cpLX, * const cpLy = (DOUBLE const*)cpLY;
+	DOUBLE const* const cpRx = (DOUBLE const*)cpRX, * const cpRy = (DOUBLE const*)cpRY;
+	for (size_t i = 0; i < count; ++i)
+		pD[i] = cpLx[i] * cpRx[i] + cpLy[i] * cpRy[i];
+}
+
+// Integer products are accumulated in 64 bits with wrap-around, so the result is exact while the sum fits in long long
+static REAL DotProductInt(void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	INT const* const cpLx = (INT const*)cpLX, * const cpLy = (INT const*)cpLY;
+	INT const* const cpRx = (INT const*)cpRX, * const cpRy = (INT const*)cpRY;
+
+	unsigned long long sum = 0;
+	for (size_t i = 0; i < count; ++i)
+		sum += (unsigned long long)((long long)cpLx[i] * cpRx[i]) + (unsigned long long)((long long)cpLy[i] * cpRy[i]);
+
+	return (REAL)(long long)sum;
+}
+
+static REAL DotProductReal(void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	REAL sum = 0;
+
+	REAL const* const cpLx = (REAL const*)cpLX, * const cpLy = (REAL const*)cpLY;
+	REAL const* const cpRx = (REAL const*)cpRX, * const cpRy = (REAL const*)cpRY;
+	for (size_t i = 0; i < count; ++i)
+		sum += cpLx[i] * cpRx[i] + cpLy[i] * cpRy[i];
+
+	return sum;
+}
+
+static REAL DotProductComplex(void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	REAL sum = 0;
+
+	COMPLEX const* const cpLx = (COMPLEX const*)cpLX, * const cpLy = (COMPLEX const*)cpLY;
+	COMPLEX const* const cpRx = (COMPLEX const*)cpRX, * const cpRy = (COMPLEX const*)cpRY;
+	for (size_t i = 0; i < count; ++i)
+		sum += (REAL)(creall(_LCmulcc(cpLx[i], conjl(cpRx[i]))) + creall(_LCmulcc(cpLy[i], conjl(cpRy[i]))));
+
+	return sum;
+}
+
+// FLOAT products are exact in double, so totals are accumulated in DOUBLE on every instruction set
+static REAL DotProductFloat(void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	DOUBLE sum = 0;
+
+	FLOAT const* const cpLx = (FLOAT const*)cpLX, * const cpLy = (FLOAT const*)cpLY;
+	FLOAT const* const cpRx = (FLOAT const*)cpRX, * const cpRy = (FLOAT const*)cpRY;
+	for (size_t i = 0; i < count; ++i)
+		sum += (DOUBLE)cpLx[i] * cpRx[i] + (DOUBLE)cpLy[i] * cpRy[i];
+
+	return (REAL)sum;
+}
+
+static REAL DotProductDouble(void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	DOUBLE sum = 0;
+
+	DOUBLE const* const cpLx = (DOUBLE const*)cpLX, * const cpLy = (DOUBLE const*)cpLY;
+	DOUBLE const* const cpRx = (DOUBLE const*)cpRX, * const cpRy = (DOUBLE const*)cpRY;
+	for (size_t i = 0; i < count; ++i)
+		sum += cpLx[i] * cpRx[i] + cpLy[i] * cpRy[i];
+
+	return (REAL)sum;
+}
+
+static const VECTOR_KERNELS SC_SCALAR_KERNELS =
+{
+	VECTOR_ISA_SCALAR,
+	{ AddInt, AddReal, AddComplex, AddFloat, AddDouble },
+	{ ScalarProductInt, ScalarProductReal, ScalarProductComplex, ScalarProductFloat, ScalarProductDouble },
+	{ DotProductInt, DotProductReal, DotProductComplex, DotProductFloat, DotProductDouble }
+};
+
+#ifdef VECTOR_X86
+
+///====================================================================================================================================
+/// SSE2 kernels.
+///====================================================================================================================================
+
+static VECTOR_TARGET("sse2") void AddInt_SSE2(void* pDst, void const* cpLHS, void const* cpRHS, size_t count)
+{
+	INT* const       pD  = (INT*)pDst;
+	INT const* const cpL = (INT const*)cpLHS;
+	INT const* const cpR = (INT const*)cpRHS;
+
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+		_mm_storeu_si128((__m128i*)(pD + i), _mm_add_epi32(_mm_loadu_si128((__m128i const*)(cpL + i)), _mm_loadu_si128((__m128i const*)(cpR + i))));
+
+	AddInt(pD + i, cpL + i, cpR + i, count - i);
+}
+
+static VECTOR_TARGET("sse2") void AddFloat_SSE2(void* pDst, void const* cpLHS, void const* cpRHS, size_t count)
+{
+	FLOAT* const       pD  = (FLOAT*)pDst;
+	FLOAT const* const cpL = (FLOAT const*)cpLHS;
+	FLOAT const* const cpR = (FLOAT const*)cpRHS;
+
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+		_mm_storeu_ps(pD + i, _mm_add_ps(_mm_loadu_ps(cpL + i), _mm_loadu_ps(cpR + i)));
+
+	AddFloat(pD + i, cpL + i, cpR + i, count - i);
+}
+
+static VECTOR_TARGET("sse2") void AddDouble_SSE2(void* pDst, void const* cpLHS, void const* cpRHS, size_t count)
+{
+	DOUBLE* const       pD  = (DOUBLE*)pDst;
+	DOUBLE const* const cpL = (DOUBLE const*)cpLHS;
+	DOUBLE const* const cpR = (DOUBLE const*)cpRHS;
+
+	size_t i = 0;
+	for (; i + 2 <= count; i += 2)
+		_mm_storeu_pd(pD + i, _mm_add_pd(_mm_loadu_pd(cpL + i), _mm_loadu_pd(cpR + i)));
+
+	AddDouble(pD + i, cpL + i, cpR + i, count - i);
+}
+
+static VECTOR_TARGET("sse2") void ScalarProductFloat_SSE2(void* pDst, void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	FLOAT* const       pD   = (FLOAT*)pDst;
+	FLOAT const* const cpLx = (FLOAT const*)cpLX, * const cpLy = (FLOAT const*)cpLY;
+	FLOAT const* const cpRx = (FLOAT const*)cpRX, * const cpRy = (FLOAT const*)cpRY;
+
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+		_mm_storeu_ps(pD + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(cpLx + i), _mm_loadu_ps(cpRx + i)), _mm_mul_ps(_mm_loadu_ps(cpLy + i), _mm_loadu_ps(cpRy + i))));
+
+	ScalarProductFloat(pD + i, cpLx + i, cpLy + i, cpRx + i, cpRy + i, count - i);
+}
+
+static VECTOR_TARGET("sse2") void ScalarProductDouble_SSE2(void* pDst, void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	DOUBLE* const       pD   = (DOUBLE*)pDst;
+	DOUBLE const* const cpLx = (DOUBLE const*)cpLX, * const cpLy = (DOUBLE const*)cpLY;
+	DOUBLE const* const cpRx = (DOUBLE const*)cpRX, * const cpRy = (DOUBLE const*)cpRY;
+
+	size_t i = 0;
+	for (; i + 2 <= count; i += 2)
+		_mm_storeu_pd(pD + i, _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(cpLx + i), _mm_loadu_pd(cpRx + i)), _mm_mul_pd(_mm_loadu_pd(cpLy + i), _mm_loadu_pd(cpRy + i))));
+
+	ScalarProductDouble(pD + i, cpLx + i, cpLy + i, cpRx + i, cpRy + i, count - i);
+}
+
+///====================================================================================================================================
+/// <summary>   Signed 32x32->64 multiplication of the even lanes. SSE2 has only the unsigned one, so the product is corrected by
+/// 			subtracting (b << 32) for negative a and (a << 32) for negative b. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+static VECTOR_TARGET("sse2") __m128i MulEpi32_SSE2(__m128i a, __m128i b)
+{
+	const __m128i correction = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a, 31), b), _mm_and_si128(_mm_srai_epi32(b, 31), a));
+
+	return _mm_sub_epi64(_mm_mul_epu32(a, b), _mm_slli_epi64(correction, 32));
+}
+
+static VECTOR_TARGET("sse2") REAL DotProductInt_SSE2(void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	INT const* const cpLx = (INT const*)cpLX, * const cpLy = (INT const*)cpLY;
+	INT const* const cpRx = (INT const*)cpRX, * const cpRy = (INT const*)cpRY;
+
+	__m128i acc = _mm_setzero_si128();
+
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		const __m128i lx = _mm_loadu_si128((__m128i const*)(cpLx + i)), rx = _mm_loadu_si128((__m128i const*)(cpRx + i));
+		const __m128i ly = _mm_loadu_si128((__m128i const*)(cpLy + i)), ry = _mm_loadu_si128((__m128i const*)(cpRy + i));
+
+		acc = _mm_add_epi64(acc, _mm_add_epi64(MulEpi32_SSE2(lx, rx), MulEpi32_SSE2(_mm_srli_epi64(lx, 32), _mm_srli_epi64(rx, 32))));
+		acc = _mm_add_epi64(acc, _mm_add_epi64(MulEpi32_SSE2(ly, ry), MulEpi32_SSE2(_mm_srli_epi64(ly, 32), _mm_srli_epi64(ry, 32))));
+	}
+
+	unsigned long long lanes[2];
+	_mm_storeu_si128((__m128i*)lanes, acc);
+
+	const unsigned long long tail = (unsigned long long)(long long)DotProductInt(cpLx + i, cpLy + i, cpRx + i, cpRy + i, count - i);
+
+	return (REAL)(long long)(lanes[0] + lanes[1] + tail);
+}
+
+static VECTOR_TARGET("sse2") REAL DotProductFloat_SSE2(void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	FLOAT const* const cpLx = (FLOAT const*)cpLX, * const cpLy = (FLOAT const*)cpLY;
+	FLOAT const* const cpRx = (FLOAT const*)cpRX, * const cpRy = (FLOAT const*)cpRY;
+
+	__m128d acc0 = _mm_setzero_pd(), acc1 = _mm_setzero_pd();
+
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		const __m128 lx = _mm_loadu_ps(cpLx + i), rx = _mm_loadu_ps(cpRx + i);
+		const __m128 ly = _mm_loadu_ps(cpLy + i), ry = _mm_loadu_ps(cpRy + i);
+
+		acc0 = _mm_add_pd(acc0, _mm_add_pd(_mm_mul_pd(_mm_cvtps_pd(lx), _mm_cvtps_pd(rx)), _mm_mul_pd(_mm_cvtps_pd(ly), _mm_cvtps_pd(ry))));
+		acc1 = _mm_add_pd(acc1, _mm_add_pd(_mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(lx, lx)), _mm_cvtps_pd(_mm_movehl_ps(rx, rx))),
+		                                   _mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(ly, ly)), _mm_cvtps_pd(_mm_movehl_ps(ry, ry)))));
+	}
+
+	double lanes[2];
+	_mm_storeu_pd(lanes, _mm_add_pd(acc0, acc1));
+
+	return (REAL)(lanes[0] + lanes[1] + (DOUBLE)DotProductFloat(cpLx + i, cpLy + i, cpRx + i, cpRy + i, count - i));
+}
+
+static VECTOR_TARGET("sse2") REAL DotProductDouble_SSE2(void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	DOUBLE const* const cpLx = (DOUBLE const*)cpLX, * const cpLy = (DOUBLE const*)cpLY;
+	DOUBLE const* const cpRx = (DOUBLE const*)cpRX, * const cpRy = (DOUBLE const*)cpRY;
+
+	__m128d acc0 = _mm_setzero_pd(), acc1 = _mm_setzero_pd();
+
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		acc0 = _mm_add_pd(acc0, _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(cpLx + i), _mm_loadu_pd(cpRx + i)), _mm_mul_pd(_mm_loadu_pd(cpLy + i), _mm_loadu_pd(cpRy + i))));
+		acc1 = _mm_add_pd(acc1, _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(cpLx + i + 2), _mm_loadu_pd(cpRx + i + 2)), _mm_mul_pd(_mm_loadu_pd(cpLy + i + 2), _mm_loadu_pd(cpRy + i + 2))));
+	}
+
+	double lanes[2];
+	_mm_storeu_pd(lanes, _mm_add_pd(acc0, acc1));
+
+	return (REAL)(lanes[0] + lanes[1] + (DOUBLE)DotProductDouble(cpLx + i, cpLy + i, cpRx + i, cpRy + i, count - i));
+}
+
+static const VECTOR_KERNELS SC_SSE2_KERNELS =
+{
+	VECTOR_ISA_SSE2,
+	{ AddInt_SSE2, AddReal, AddComplex, AddFloat_SSE2, AddDouble_SSE2 },
+	{ ScalarProductInt, ScalarProductReal, ScalarProductComplex, ScalarProductFloat_SSE2, ScalarProductDouble_SSE2 },
+	{ DotProductInt_SSE2, DotProductReal, DotProductComplex, DotProductFloat_SSE2, DotProductDouble_SSE2 }
+};
+
+///====================================================================================================================================
+/// AVX2 kernels.
+///====================================================================================================================================
+
+static VECTOR_TARGET("avx2") void AddInt_AVX2(void* pDst, void const* cpLHS, void const* cpRHS, size_t count)
+{
+	INT* const       pD  = (INT*)pDst;
+	INT const* const cpL = (INT const*)cpLHS;
+	INT const* const cpR = (INT const*)cpRHS;
+
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+		_mm256_storeu_si256((__m256i*)(pD + i), _mm256_add_epi32(_mm256_loadu_si256((__m256i const*)(cpL + i)), _mm256_loadu_si256((__m256i const*)(cpR + i))));
+
+	AddInt(pD + i, cpL + i, cpR + i, count - i);
+}
+
+static VECTOR_TARGET("avx2") void AddFloat_AVX2(void* pDst, void const* cpLHS, void const* cpRHS, size_t count)
+{
+	FLOAT* const       pD  = (FLOAT*)pDst;
+	FLOAT const* const cpL = (FLOAT const*)cpLHS;
+	FLOAT const* const cpR = (FLOAT const*)cpRHS;
+
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+		_mm256_storeu_ps(pD + i, _mm256_add_ps(_mm256_loadu_ps(cpL + i), _mm256_loadu_ps(cpR + i)));
+
+	AddFloat(pD + i, cpL + i, cpR + i, count - i);
+}
+
+static VECTOR_TARGET("avx2") void AddDouble_AVX2(void* pDst, void const* cpLHS, void const* cpRHS, size_t count)
+{
+	DOUBLE* const       pD  = (DOUBLE*)pDst;
+	DOUBLE const* const cpL = (DOUBLE const*)cpLHS;
+	DOUBLE const* const cpR = (DOUBLE const*)cpRHS;
+
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+		_mm256_storeu_pd(pD + i, _mm256_add_pd(_mm256_loadu_pd(cpL + i), _mm256_loadu_pd(cpR + i)));
+
+	AddDouble(pD + i, cpL + i, cpR + i, count - i);
+}
+
+static VECTOR_TARGET("avx2") void ScalarProductFloat_AVX2(void* pDst, void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	FLOAT* const       pD   = (FLOAT*)pDst;
+	FLOAT const* const cpLx = (FLOAT const*)cpLX, * const cpLy = (FLOAT const*)cpLY;
+	FLOAT const* const cpRx = (FLOAT const*)cpRX, * const cpRy = (FLOAT const*)cpRY;
+
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+		_mm256_storeu_ps(pD + i, _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(cpLx + i), _mm256_loadu_ps(cpRx + i)), _mm256_mul_ps(_mm256_loadu_ps(cpLy + i), _mm256_loadu_ps(cpRy + i))));
+
+	ScalarProductFloat(pD + i, cpLx + i, cpLy + i, cpRx + i, cpRy + i, count - i);
+}
+
+static VECTOR_TARGET("avx2") void ScalarProductDouble_AVX2(void* pDst, void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	DOUBLE* const       pD   = (DOUBLE*)pDst;
+	DOUBLE const* const cpLx = (DOUBLE const*)cpLX, * const cpLy = (DOUBLE const*)cpLY;
+	DOUBLE const* const cpRx = (DOUBLE const*)cpRX, * const cpRy = (DOUBLE const*)cpRY;
+
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+		_mm256_storeu_pd(pD + i, _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(cpLx + i), _mm256_loadu_pd(cpRx + i)), _mm256_mul_pd(_mm256_loadu_pd(cpLy + i), _mm256_loadu_pd(cpRy + i))));
+
+	ScalarProductDouble(pD + i, cpLx + i, cpLy + i, cpRx + i, cpRy + i, count - i);
+}
+
+static VECTOR_TARGET("avx2") REAL DotProductInt_AVX2(void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	INT const* const cpLx = (INT const*)cpLX, * const cpLy = (INT const*)cpLY;
+	INT const* const cpRx = (INT const*)cpRX, * const cpRy = (INT const*)cpRY;
+
+	__m256i acc = _mm256_setzero_si256();
+
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		const __m256i lx = _mm256_loadu_si256((__m256i const*)(cpLx + i)), rx = _mm256_loadu_si256((__m256i const*)(cpRx + i));
+		const __m256i ly = _mm256_loadu_si256((__m256i const*)(cpLy + i)), ry = _mm256_loadu_si256((__m256i const*)(cpRy + i));
+
+		acc = _mm256_add_epi64(acc, _mm256_add_epi64(_mm256_mul_epi32(lx, rx), _mm256_mul_epi32(_mm256_srli_epi64(lx, 32), _mm256_srli_epi64(rx, 32))));
+		acc = _mm256_add_epi64(acc, _mm256_add_epi64(_mm256_mul_epi32(ly, ry), _mm256_mul_epi32(_mm256_srli_epi64(ly, 32), _mm256_srli_epi64(ry, 32))));
+	}
+
+	unsigned long long lanes[4];
+	_mm256_storeu_si256((__m256i*)lanes, acc);
+
+	const unsigned long long tail = (unsigned long long)(long long)DotProductInt(cpLx + i, cpLy + i, cpRx + i, cpRy + i, count - i);
+
+	return (REAL)(long long)(lanes[0] + lanes[1] + lanes[2] + lanes[3] + tail);
+}
+
+static VECTOR_TARGET("avx2") REAL DotProductFloat_AVX2(void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	FLOAT const* const cpLx = (FLOAT const*)cpLX, * const cpLy = (FLOAT const*)cpLY;
+	FLOAT const* const cpRx = (FLOAT const*)cpRX, * const cpRy = (FLOAT const*)cpRY;
+
+	__m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		acc0 = _mm256_add_pd(acc0, _mm256_add_pd(_mm256_mul_pd(_mm256_cvtps_pd(_mm_loadu_ps(cpLx + i)), _mm256_cvtps_pd(_mm_loadu_ps(cpRx + i))),
+		                                         _mm256_mul_pd(_mm256_cvtps_pd(_mm_loadu_ps(cpLy + i)), _mm256_cvtps_pd(_mm_loadu_ps(cpRy + i)))));
+		acc1 = _mm256_add_pd(acc1, _mm256_add_pd(_mm256_mul_pd(_mm256_cvtps_pd(_mm_loadu_ps(cpLx + i + 4)), _mm256_cvtps_pd(_mm_loadu_ps(cpRx + i + 4))),
+		                                         _mm256_mul_pd(_mm256_cvtps_pd(_mm_loadu_ps(cpLy + i + 4)), _mm256_cvtps_pd(_mm_loadu_ps(cpRy + i + 4)))));
+	}
+
+	double lanes[4];
+	_mm256_storeu_pd(lanes, _mm256_add_pd(acc0, acc1));
+
+	return (REAL)(lanes[0] + lanes[1] + lanes[2] + lanes[3] + (DOUBLE)DotProductFloat(cpLx + i, cpLy + i, cpRx + i, cpRy + i, count - i));
+}
+
+static VECTOR_TARGET("avx2") REAL DotProductDouble_AVX2(void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	DOUBLE const* const cpLx = (DOUBLE const*)cpLX, * const cpLy = (DOUBLE const*)cpLY;
+	DOUBLE const* const cpRx = (DOUBLE const*)cpRX, * const cpRy = (DOUBLE const*)cpRY;
+
+	__m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		acc0 = _mm256_add_pd(acc0, _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(cpLx + i), _mm256_loadu_pd(cpRx + i)), _mm256_mul_pd(_mm256_loadu_pd(cpLy + i), _mm256_loadu_pd(cpRy + i))));
+		acc1 = _mm256_add_pd(acc1, _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(cpLx + i + 4), _mm256_loadu_pd(cpRx + i + 4)), _mm256_mul_pd(_mm256_loadu_pd(cpLy + i + 4), _mm256_loadu_pd(cpRy + i + 4))));
+	}
+
+	double lanes[4];
+	_mm256_storeu_pd(lanes, _mm256_add_pd(acc0, acc1));
+
+	return (REAL)(lanes[0] + lanes[1] + lanes[2] + lanes[3] + (DOUBLE)DotProductDouble(cpLx + i, cpLy + i, cpRx + i, cpRy + i, count - i));
+}
+
+static const VECTOR_KERNELS SC_AVX2_KERNELS =
+{
+	VECTOR_ISA_AVX2,
+	{ AddInt_AVX2, AddReal, AddComplex, AddFloat_AVX2, AddDouble_AVX2 },
+	{ ScalarProductInt, ScalarProductReal, ScalarProductComplex, ScalarProductFloat_AVX2, ScalarProductDouble_AVX2 },
+	{ DotProductInt_AVX2, DotProductReal, DotProductComplex, DotProductFloat_AVX2, DotProductDouble_AVX2 }
+};
+
+///====================================================================================================================================
+/// AVX-512 kernels (AVX512F only).
+///====================================================================================================================================
+
+static VECTOR_TARGET("avx512f") void AddInt_AVX512(void* pDst, void const* cpLHS, void const* cpRHS, size_t count)
+{
+	INT* const       pD  = (INT*)pDst;
+	INT const* const cpL = (INT const*)cpLHS;
+	INT const* const cpR = (INT const*)cpRHS;
+
+	size_t i = 0;
+	for (; i + 16 <= count; i += 16)
+		_mm512_storeu_si512(pD + i, _mm512_add_epi32(_mm512_loadu_si512(cpL + i), _mm512_loadu_si512(cpR + i)));
+
+	AddInt(pD + i, cpL + i, cpR + i, count - i);
+}
+
+static VECTOR_TARGET("avx512f") void AddFloat_AVX512(void* pDst, void const* cpLHS, void const* cpRHS, size_t count)
+{
+	FLOAT* const       pD  = (FLOAT*)pDst;
+	FLOAT const* const cpL = (FLOAT const*)cpLHS;
+	FLOAT const* const cpR = (FLOAT const*)cpRHS;
+
+	size_t i = 0;
+	for (; i + 16 <= count; i += 16)
+		_mm512_storeu_ps(pD + i, _mm512_add_ps(_mm512_loadu_ps(cpL + i), _mm512_loadu_ps(cpR + i)));
+
+	AddFloat(pD + i, cpL + i, cpR + i, count - i);
+}
+
+static VECTOR_TARGET("avx512f") void AddDouble_AVX512(void* pDst, void const* cpLHS, void const* cpRHS, size_t count)
+{
+	DOUBLE* const       pD  = (DOUBLE*)pDst;
+	DOUBLE const* const cpL = (DOUBLE const*)cpLHS;
+	DOUBLE const* const cpR = (DOUBLE const*)cpRHS;
+
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+		_mm512_storeu_pd(pD + i, _mm512_add_pd(_mm512_loadu_pd(cpL + i), _mm512_loadu_pd(cpR + i)));
+
+	AddDouble(pD + i, cpL + i, cpR + i, count - i);
+}
+
+static VECTOR_TARGET("avx512f") void ScalarProductFloat_AVX512(void* pDst, void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	FLOAT* const       pD   = (FLOAT*)pDst;
+	FLOAT const* const cpLx = (FLOAT const*)cpLX, * const cpLy = (FLOAT const*)cpLY;
+	FLOAT const* const cpRx = (FLOAT const*)cpRX, * const cpRy = (FLOAT const*)cpRY;
+
+	size_t i = 0;
+	for (; i + 16 <= count; i += 16)
+		_mm512_storeu_ps(pD + i, _mm512_add_ps(_mm512_mul_ps(_mm512_loadu_ps(cpLx + i), _mm512_loadu_ps(cpRx + i)), _mm512_mul_ps(_mm512_loadu_ps(cpLy + i), _mm512_loadu_ps(cpRy + i))));
+
+	ScalarProductFloat(pD + i, cpLx + i, cpLy + i, cpRx + i, cpRy + i, count - i);
+}
+
+static VECTOR_TARGET("avx512f") void ScalarProductDouble_AVX512(void* pDst, void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	DOUBLE* const       pD   = (DOUBLE*)pDst;
+	DOUBLE const* const cpLx = (DOUBLE const*)cpLX, * const cpLy = (DOUBLE const*)cpLY;
+	DOUBLE const* const cpRx = (DOUBLE const*)cpRX, * const cpRy = (DOUBLE const*)cpRY;
+
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+		_mm512_storeu_pd(pD + i, _mm512_add_pd(_mm512_mul_pd(_mm512_loadu_pd(cpLx + i), _mm512_loadu_pd(cpRx + i)), _mm512_mul_pd(_mm512_loadu_pd(cpLy + i), _mm512_loadu_pd(cpRy + i))));
+
+	ScalarProductDouble(pD + i, cpLx + i, cpLy + i, cpRx + i, cpRy + i, count - i);
+}
+
+static VECTOR_TARGET("avx512f") REAL DotProductInt_AVX512(void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	INT const* const cpLx = (INT const*)cpLX, * const cpLy = (INT const*)cpLY;
+	INT const* const cpRx = (INT const*)cpRX, * const cpRy = (INT const*)cpRY;
+
+	__m512i acc = _mm512_setzero_si512();
+
+	size_t i = 0;
+	for (; i + 16 <= count; i += 16)
+	{
+		const __m512i lx = _mm512_loadu_si512(cpLx + i), rx = _mm512_loadu_si512(cpRx + i);
+		const __m512i ly = _mm512_loadu_si512(cpLy + i), ry = _mm512_loadu_si512(cpRy + i);
+
+		acc = _mm512_add_epi64(acc, _mm512_add_epi64(_mm512_mul_epi32(lx, rx), _mm512_mul_epi32(_mm512_srli_epi64(lx, 32), _mm512_srli_epi64(rx, 32))));
+		acc = _mm512_add_epi64(acc, _mm512_add_epi64(_mm512_mul_epi32(ly, ry), _mm512_mul_epi32(_mm512_srli_epi64(ly, 32), _mm512_srli_epi64(ry, 32))));
+	}
+
+	unsigned long long lanes[8];
+	_mm512_storeu_si512(lanes, acc);
+
+	unsigned long long sum = (unsigned long long)(long long)DotProductInt(cpLx + i, cpLy + i, cpRx + i, cpRy + i, count - i);
+	for (int lane = 0; lane < 8; ++lane)
+		sum += lanes[lane];
+
+	return (REAL)(long long)sum;
+}
+
+static VECTOR_TARGET("avx512f") REAL DotProductFloat_AVX512(void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	FLOAT const* const cpLx = (FLOAT const*)cpLX, * const cpLy = (FLOAT const*)cpLY;
+	FLOAT const* const cpRx = (FLOAT const*)cpRX, * const cpRy = (FLOAT const*)cpRY;
+
+	__m512d acc0 = _mm512_setzero_pd(), acc1 = _mm512_setzero_pd();
+
+	size_t i = 0;
+	for (; i + 16 <= count; i += 16)
+	{
+		acc0 = _mm512_add_pd(acc0, _mm512_add_pd(_mm512_mul_pd(_mm512_cvtps_pd(_mm256_loadu_ps(cpLx + i)), _mm512_cvtps_pd(_mm256_loadu_ps(cpRx + i))),
+		                                         _mm512_mul_pd(_mm512_cvtps_pd(_mm256_loadu_ps(cpLy + i)), _mm512_cvtps_pd(_mm256_loadu_ps(cpRy + i)))));
+		acc1 = _mm512_add_pd(acc1, _mm512_add_pd(_mm512_mul_pd(_mm512_cvtps_pd(_mm256_loadu_ps(cpLx + i + 8)), _mm512_cvtps_pd(_mm256_loadu_ps(cpRx + i + 8))),
+		                                         _mm512_mul_pd(_mm512_cvtps_pd(_mm256_loadu_ps(cpLy + i + 8)), _mm512_cvtps_pd(_mm256_loadu_ps(cpRy + i + 8)))));
+	}
+
+	double lanes[8];
+	_mm512_storeu_pd(lanes, _mm512_add_pd(acc0, acc1));
+
+	DOUBLE sum = (DOUBLE)DotProductFloat(cpLx + i, cpLy + i, cpRx + i, cpRy + i, count - i);
+	for (int lane = 0; lane < 8; ++lane)
+		sum += lanes[lane];
+
+	return (REAL)sum;
+}
+
+static VECTOR_TARGET("avx512f") REAL DotProductDouble_AVX512(void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count)
+{
+	DOUBLE const* const cpLx = (DOUBLE const*)cpLX, * const cpLy = (DOUBLE const*)cpLY;
+	DOUBLE const* const cpRx = (DOUBLE const*)cpRX, * const cpRy = (DOUBLE const*)cpRY;
+
+	__m512d acc0 = _mm512_setzero_pd(), acc1 = _mm512_setzero_pd();
+
+	size_t i = 0;
+	for (; i + 16 <= count; i += 16)
+	{
+		acc0 = _mm512_add_pd(acc0, _mm512_add_pd(_mm512_mul_pd(_mm512_loadu_pd(cpLx + i), _mm512_loadu_pd(cpRx + i)), _mm512_mul_pd(_mm512_loadu_pd(cpLy + i), _mm512_loadu_pd(cpRy + i))));
+		acc1 = _mm512_add_pd(acc1, _mm512_add_pd(_mm512_mul_pd(_mm512_loadu_pd(cpLx + i + 8), _mm512_loadu_pd(cpRx + i + 8)), _mm512_mul_pd(_mm512_loadu_pd(cpLy + i + 8), _mm512_loadu_pd(cpRy + i + 8))));
+	}
+
+	double lanes[8];
+	_mm512_storeu_pd(lanes, _mm512_add_pd(acc0, acc1));
+
+	DOUBLE sum = (DOUBLE)DotProductDouble(cpLx + i, cpLy + i, cpRx + i, cpRy + i, count - i);
+	for (int lane = 0; lane < 8; ++lane)
+		sum += lanes[lane];
+
+	return (REAL)sum;
+}
+
+static const VECTOR_KERNELS SC_AVX512_KERNELS =
+{
+	VECTOR_ISA_AVX512,
+	{ AddInt_AVX512, AddReal, AddComplex, AddFloat_AVX512, AddDouble_AVX512 },
+	{ ScalarProductInt, ScalarProductReal, ScalarProductComplex, ScalarProductFloat_AVX512, ScalarProductDouble_AVX512 },
+	{ DotProductInt_AVX512, DotProductReal, DotProductComplex, DotProductFloat_AVX512, DotProductDouble_AVX512 }
+};
+
+#endif /* VECTOR_X86 */
+
+///====================================================================================================================================
+/// <summary>   Detects the best instruction set supported by both the CPU and the OS. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <returns>	One of VECTOR_ISA_*. </returns>
+///====================================================================================================================================
+static int DetectIsa(void)
+{
+#if defined(VECTOR_X86) && defined(_MSC_VER)
+	int regs[4];
+	__cpuid(regs, 0);
+	const int maxLeaf = regs[0];
+
+	__cpuid(regs, 1);
+	const int sse2    = (regs[3] >> 26) & 1;
+	const int osxsave = (regs[2] >> 27) & 1;
+	const int avx     = (regs[2] >> 28) & 1;
+
+	// The OS has to save YMM (bits 1-2) and ZMM (bits 5-7) state on context switches
+	const unsigned long long xcr0 = (osxsave && avx) ? _xgetbv(0) : 0ULL;
+
+	int avx2 = 0, avx512f = 0;
+	if (maxLeaf >= 7)
+	{
+		__cpuidex(regs, 7, 0);
+		avx2    = (regs[1] >> 5)  & 1;
+		avx512f = (regs[1] >> 16) & 1;
+	}
+
+	if (avx512f && (xcr0 & 0xE6) == 0xE6)
+		return VECTOR_ISA_AVX512;
+	else if (avx2 && (xcr0 & 0x6) == 0x6)
+		return VECTOR_ISA_AVX2;
+	else if (sse2)
+		return VECTOR_ISA_SSE2;
+	else
+		return VECTOR_ISA_SCALAR;
+#elif defined(VECTOR_X86)
+	// Checks the OS support as well
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("avx512f"))
+		return VECTOR_ISA_AVX512;
+	else if (__builtin_cpu_supports("avx2"))
+		return VECTOR_ISA_AVX2;
+	else if (__builtin_cpu_supports("sse2"))
+		return VECTOR_ISA_SSE2;
+	else
+		return VECTOR_ISA_SCALAR;
+#else
+	return VECTOR_ISA_SCALAR;
+#endif /* VECTOR_X86 */
+}
+
+const VECTOR_KERNELS* GetVectorKernels(void)
+{
+	static const VECTOR_KERNELS* volatile s_cpKernels = NULL;
+
+	const VECTOR_KERNELS* cpKernels = (const VECTOR_KERNELS*)LoadPointer(&s_cpKernels);
+	if (!cpKernels)
+	{
+		const int isa = DetectIsa();
+
+#ifdef VECTOR_X86
+		if (isa == VECTOR_ISA_AVX512)
+			cpKernels = &SC_AVX512_KERNELS;
+		else if (isa == VECTOR_ISA_AVX2)
+			cpKernels = &SC_AVX2_KERNELS;
+		else if (isa == VECTOR_ISA_SSE2)
+			cpKernels = &SC_SSE2_KERNELS;
+		else
+#endif /* VECTOR_X86 */
+			cpKernels = &SC_SCALAR_KERNELS;
+
+		(void)isa;
+
+		// Threads racing here select the same table, the first one published wins
+		const VECTOR_KERNELS* const cpPublished = (const VECTOR_KERNELS*)CompareExchangePointer(&s_cpKernels, cpKernels, NULL);
+		if (cpPublished)
+			cpKernels = cpPublished;
+	}
+
+	return cpKernels;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+///====================================================================================================================================
+/// File:				VectorKernels.h
+/// Author:				MyLibh
+/// Created:			17.10.2026
+///
+/// Last modified by:	MyLibh
+/// Last modified on:	17.10.2026
+///====================================================================================================================================
+/// Copyright(c) MyLibh. All rights reserved.
+///====================================================================================================================================
+
+#ifndef __VECTORKERNELS_H_INCLUDED__
+#define __VECTORKERNELS_H_INCLUDED__
+
+#include "Vector.h"
+
+/// [url] https://en.cppreference.com/w/c/types/size_t [/url]
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#define VECTOR_ISA_SCALAR 0x0
+#define VECTOR_ISA_SSE2   0x1
+#define VECTOR_ISA_AVX2   0x2
+#define VECTOR_ISA_AVX512 0x3
+
+///====================================================================================================================================
+/// <summary>   Element-wise sum of two component arrays. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+typedef void (*PFN_ADD_KERNEL)(void* pDst, void const* cpLHS, void const* cpRHS, size_t count);
+
+///====================================================================================================================================
+/// <summary>
+/// 	Scalar products of the corresponding vectors. Results are REAL for VECTOR_INTEGRAL, VECTOR_REAL and VECTOR_COMPLEX, and have
+/// 	the component type for VECTOR_FLOAT and VECTOR_DOUBLE.
+/// </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+typedef void (*PFN_SCALAR_PRODUCT_KERNEL)(void* pDst, void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count);
+
+///====================================================================================================================================
+/// <summary>   Sum of the scalar products of the corresponding vectors. </summary>
+///
+/// <remarks>
+/// 	MyLibh, 17.10.2026. SIMD kernels keep a partial sum per lane, so FLOAT and DOUBLE results depend on the instruction set in
+/// 	the last bits. INT results are exact.
+/// </remarks>
+///====================================================================================================================================
+typedef REAL (*PFN_DOT_PRODUCT_KERNEL)(void const* cpLX, void const* cpLY, void const* cpRX, void const* cpRY, size_t count);
+
+///====================================================================================================================================
+/// <summary>   Table of kernels indexed by the component type. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+
+typedef struct _VectorKernels
+{
+	int                       isa;
+	PFN_ADD_KERNEL            pfnAdd[VECTOR_TYPE_COUNT];
+	PFN_SCALAR_PRODUCT_KERNEL pfnScalarProduct[VECTOR_TYPE_COUNT];
+	PFN_DOT_PRODUCT_KERNEL    pfnDotProduct[VECTOR_TYPE_COUNT];
+} VECTOR_KERNELS;
+
+///====================================================================================================================================
+/// <summary>   Gets kernels for the best instruction set supported by the CPU. The choice is made once, on the first call. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <returns>	Kernel table. </returns>
+///====================================================================================================================================
+const VECTOR_KERNELS* GetVectorKernels(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __VECTORKERNELS_H_INCLUDED__ */
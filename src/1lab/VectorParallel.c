@@ -0,0 +1,532 @@
+// This is a personal academic project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+#include "VectorParallel.h"
+
+/// [url] https://en.cppreference.com/w/cpp/header/cstdlib [/url]
+#include <stdlib.h>
+/// [url] https://en.cppreference.com/w/cpp/header/cmath [/url]
+#include <math.h>
+
+#ifdef _WIN32
+/// [url] https://docs.microsoft.com/en-us/windows/win32/sync/synchronization-functions [/url]
+#include <windows.h>
+/// [url] https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/beginthread-beginthreadex?view=vs-2019 [/url]
+#include <process.h>
+
+typedef HANDLE             THREAD;
+typedef SRWLOCK            MUTEX;
+typedef CONDITION_VARIABLE CONDITION;
+
+#define MutexInit(pMutex)             InitializeSRWLock(pMutex)
+#define MutexDestroy(pMutex)          ((void)(pMutex))
+#define MutexLock(pMutex)             AcquireSRWLockExclusive(pMutex)
+#define MutexUnlock(pMutex)           ReleaseSRWLockExclusive(pMutex)
+#define ConditionInit(pCond)          InitializeConditionVariable(pCond)
+#define ConditionDestroy(pCond)       ((void)(pCond))
+#define ConditionWait(pCond, pMutex)  SleepConditionVariableSRW(pCond, pMutex, INFINITE, 0)
+#define ConditionSignal(pCond)        WakeConditionVariable(pCond)
+#define ConditionBroadcast(pCond)     WakeAllConditionVariable(pCond)
+#else
+/// [url] https://pubs.opengroup.org/onlinepubs/9699919799/basedefs/pthread.h.html [/url]
+#include <pthread.h>
+/// [url] https://pubs.opengroup.org/onlinepubs/9699919799/basedefs/unistd.h.html [/url]
+#include <unistd.h>
+
+typedef pthread_t       THREAD;
+typedef pthread_mutex_t MUTEX;
+typedef pthread_cond_t  CONDITION;
+
+#define MutexInit(pMutex)             pthread_mutex_init(pMutex, NULL)
+#define MutexDestroy(pMutex)          pthread_mutex_destroy(pMutex)
+#define MutexLock(pMutex)             pthread_mutex_lock(pMutex)
+#define MutexUnlock(pMutex)           pthread_mutex_unlock(pMutex)
+#define ConditionInit(pCond)          pthread_cond_init(pCond, NULL)
+#define ConditionDestroy(pCond)       pthread_cond_destroy(pCond)
+#define ConditionWait(pCond, pMutex)  pthread_cond_wait(pCond, pMutex)
+#define ConditionSignal(pCond)        pthread_cond_signal(pCond)
+#define ConditionBroadcast(pCond)     pthread_cond_broadcast(pCond)
+#endif /* _WIN32 */
+
+///====================================================================================================================================
+/// <summary>   Task run for every chunk of the current job. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+typedef void (*PFN_CHUNK_TASK)(void* pContext, size_t chunk);
+
+struct _VectorThreadPool
+{
+	size_t         nThreads;
+	THREAD*        pThreads;
+	MUTEX          mutex;
+	CONDITION      cvWork;
+	CONDITION      cvDone;
+	unsigned long  generation;
+	size_t         nActive;
+	int            stop;
+
+	PFN_CHUNK_TASK pfnTask;
+	void*          pContext;
+	size_t         nChunks;
+	size_t         nextChunk;
+};
+
+///====================================================================================================================================
+/// <summary>   Neumaier-compensated sum. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+
+typedef struct _CompensatedSum
+{
+	REAL sum;
+	REAL compensation;
+} COMPENSATED_SUM;
+
+///====================================================================================================================================
+/// <summary>   Partial result of one chunk. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. acc[0..3] hold x, y (or re x, im x, re y, im y for VECTOR_COMPLEX), exact[] the INT sums. </remarks>
+///====================================================================================================================================
+
+typedef struct _Partial
+{
+	COMPENSATED_SUM    acc[4];
+	unsigned long long exact[2];
+} PARTIAL;
+
+typedef struct _ReductionContext
+{
+	PVECTOR_BATCH cpLHB;
+	PVECTOR_BATCH cpRHB;
+	PARTIAL*      pPartials;
+} REDUCTION_CONTEXT;
+
+static void CompensatedAdd(COMPENSATED_SUM* pSum, REAL value)
+{
+	const REAL t = pSum->sum + value;
+	if (fabsl(pSum->sum) >= fabsl(value))
+		pSum->compensation += (pSum->sum - t) + value;
+	else
+		pSum->compensation += (value - t) + pSum->sum;
+
+	pSum->sum = t;
+}
+
+static void CompensatedMerge(COMPENSATED_SUM* pSum, const COMPENSATED_SUM* cpOther)
+{
+	CompensatedAdd(pSum, cpOther->sum);
+	pSum->compensation += cpOther->compensation;
+}
+
+static REAL CompensatedResult(const COMPENSATED_SUM* cpSum)
+{
+	return cpSum->sum + cpSum->compensation;
+}
+
+///====================================================================================================================================
+/// <summary>   Runs chunks of the current job until there are none left. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. Which thread takes a chunk doesn't matter, every chunk writes only its own partial. </remarks>
+///
+/// <param name="pPool">	Pool. </param>
+///====================================================================================================================================
+static void RunChunks(PVECTOR_THREAD_POOL pPool)
+{
+	for (;;)
+	{
+		MutexLock(&pPool->mutex);
+		const size_t chunk = pPool->nextChunk++;
+		MutexUnlock(&pPool->mutex);
+
+		if (chunk >= pPool->nChunks)
+			break;
+
+		pPool->pfnTask(pPool->pContext, chunk);
+	}
+}
+
+#ifdef _WIN32
+static unsigned __stdcall WorkerProc(void* pParam)
+#else
+static void* WorkerProc(void* pParam)
+#endif /* _WIN32 */
+{
+	PVECTOR_THREAD_POOL pPool = (PVECTOR_THREAD_POOL)pParam;
+
+	unsigned long seen = 0;
+
+	MutexLock(&pPool->mutex);
+	for (;;)
+	{
+		while (!pPool->stop && seen == pPool->generation)
+			ConditionWait(&pPool->cvWork, &pPool->mutex);
+
+		if (pPool->stop)
+			break;
+
+		seen = pPool->generation;
+		MutexUnlock(&pPool->mutex);
+
+		RunChunks(pPool);
+
+		MutexLock(&pPool->mutex);
+		if (--pPool->nActive == 0)
+			ConditionSignal(&pPool->cvDone);
+	}
+	MutexUnlock(&pPool->mutex);
+
+	return 0;
+}
+
+///====================================================================================================================================
+/// <summary>   Runs task for chunks [0, nChunks) on all threads of the pool and waits for them. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="pPool">	Pool or NULL. </param>
+/// <param name="pfnTask">	Task. </param>
+/// <param name="pContext">	Context of the task. </param>
+/// <param name="nChunks">	Number of chunks. </param>
+///====================================================================================================================================
+static void RunJob(PVECTOR_THREAD_POOL pPool, PFN_CHUNK_TASK pfnTask, void* pContext, size_t nChunks)
+{
+	if (!pPool || pPool->nThreads < 2 || nChunks < 2)
+	{
+		for (size_t chunk = 0; chunk < nChunks; ++chunk)
+			pfnTask(pContext, chunk);
+
+		return;
+	}
+
+	MutexLock(&pPool->mutex);
+	pPool->pfnTask   = pfnTask;
+	pPool->pContext  = pContext;
+	pPool->nChunks   = nChunks;
+	pPool->nextChunk = 0;
+	pPool->nActive   = pPool->nThreads - 1;
+	++pPool->generation;
+	ConditionBroadcast(&pPool->cvWork);
+	MutexUnlock(&pPool->mutex);
+
+	RunChunks(pPool);
+
+	MutexLock(&pPool->mutex);
+	while (pPool->nActive)
+		ConditionWait(&pPool->cvDone, &pPool->mutex);
+	MutexUnlock(&pPool->mutex);
+}
+
+static size_t GetProcessorCount(void)
+{
+#ifdef _WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+
+	return (size_t)info.dwNumberOfProcessors;
+#else
+	const long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+	return count > 0 ? (size_t)count : 1;
+#endif /* _WIN32 */
+}
+
+PVECTOR_THREAD_POOL CreateVectorThreadPool(size_t nThreads)
+{
+	VECTOR_THREAD_POOL* pPool = (VECTOR_THREAD_POOL*)calloc(1, sizeof(VECTOR_THREAD_POOL));
+	if (!pPool)
+		return NULL;
+
+	pPool->nThreads = nThreads ? nThreads : GetProcessorCount();
+	if (pPool->nThreads > 1)
+	{
+		pPool->pThreads = (THREAD*)calloc(pPool->nThreads - 1, sizeof(THREAD));
+		if (!pPool->pThreads)
+		{
+			free(pPool);
+
+			return NULL;
+		}
+	}
+
+	MutexInit(&pPool->mutex);
+	ConditionInit(&pPool->cvWork);
+	ConditionInit(&pPool->cvDone);
+
+	for (size_t i = 0; i + 1 < pPool->nThreads; ++i)
+	{
+#ifdef _WIN32
+		pPool->pThreads[i] = (HANDLE)_beginthreadex(NULL, 0, WorkerProc, pPool, 0, NULL);
+		const int started = pPool->pThreads[i] != NULL;
+#else
+		const int started = !pthread_create(&pPool->pThreads[i], NULL, WorkerProc, pPool);
+#endif /* _WIN32 */
+		if (!started)
+		{
+			// Keep the workers already running, RunJob only needs the count
+			pPool->nThreads = i + 1;
+			break;
+		}
+	}
+
+	return pPool;
+}
+
+void DeleteVectorThreadPool(PVECTOR_THREAD_POOL pPool)
+{
+	if (pPool)
+	{
+		MutexLock(&pPool->mutex);
+		pPool->stop = 1;
+		ConditionBroadcast(&pPool->cvWork);
+		MutexUnlock(&pPool->mutex);
+
+		for (size_t i = 0; i + 1 < pPool->nThreads; ++i)
+		{
+#ifdef _WIN32
+			WaitForSingleObject(pPool->pThreads[i], INFINITE);
+			CloseHandle(pPool->pThreads[i]);
+#else
+			pthread_join(pPool->pThreads[i], NULL);
+#endif /* _WIN32 */
+		}
+
+		ConditionDestroy(&pPool->cvDone);
+		ConditionDestroy(&pPool->cvWork);
+		MutexDestroy(&pPool->mutex);
+
+		free(pPool->pThreads);
+		free(pPool);
+		pPool = NULL;
+	}
+}
+
+size_t GetThreadPoolSize(const PVECTOR_THREAD_POOL cpPool)
+{
+	return cpPool ? cpPool->nThreads : 1;
+}
+
+static void DotProductChunk(void* pContext, size_t chunk)
+{
+	REDUCTION_CONTEXT* const pCtx = (REDUCTION_CONTEXT*)pContext;
+	PVECTOR_BATCH const      cpL  = pCtx->cpLHB, cpR = pCtx->cpRHB;
+	PARTIAL* const           pP   = &pCtx->pPartials[chunk];
+
+	const size_t first = chunk * VECTOR_PARALLEL_CHUNK;
+	const size_t last  = first + VECTOR_PARALLEL_CHUNK < cpL->size ? first + VECTOR_PARALLEL_CHUNK : cpL->size;
+	switch (cpL->type)
+	{
+	case VECTOR_INTEGRAL:
+		for (size_t i = first; i < last; ++i)
+			pP->exact[0] += (unsigned long long)((long long)BATCH_X(cpL, INT, i) * BATCH_X(cpR, INT, i)) +
+			                (unsigned long long)((long long)BATCH_Y(cpL, INT, i) * BATCH_Y(cpR, INT, i));
+		break;
+
+	case VECTOR_REAL:
+		for (size_t i = first; i < last; ++i)
+		{
+			CompensatedAdd(&pP->acc[0], BATCH_X(cpL, REAL, i) * BATCH_X(cpR, REAL, i));
+			CompensatedAdd(&pP->acc[0], BATCH_Y(cpL, REAL, i) * BATCH_Y(cpR, REAL, i));
+		}
+		break;
+
+	case VECTOR_COMPLEX:
+		// re(l * conj(r)) = re(l) * re(r) + im(l) * im(r)
+		for (size_t i = first; i < last; ++i)
+		{
+			const COMPLEX lx = BATCH_X(cpL, COMPLEX, i), ly = BATCH_Y(cpL, COMPLEX, i);
+			const COMPLEX rx = BATCH_X(cpR, COMPLEX, i), ry = BATCH_Y(cpR, COMPLEX, i);
+			CompensatedAdd(&pP->acc[0], creall(lx) * creall(rx));
+			CompensatedAdd(&pP->acc[0], cimagl(lx) * cimagl(rx));
+			CompensatedAdd(&pP->acc[0], creall(ly) * creall(ry));
+			CompensatedAdd(&pP->acc[0], cimagl(ly) * cimagl(ry));
+		}
+		break;
+
+	case VECTOR_FLOAT:
+		for (size_t i = first; i < last; ++i)
+		{
+			CompensatedAdd(&pP->acc[0], (REAL)BATCH_X(cpL, FLOAT, i) * BATCH_X(cpR, FLOAT, i));
+			CompensatedAdd(&pP->acc[0], (REAL)BATCH_Y(cpL, FLOAT, i) * BATCH_Y(cpR, FLOAT, i));
+		}
+		break;
+
+	case VECTOR_DOUBLE:
+		for (size_t i = first; i < last; ++i)
+		{
+			CompensatedAdd(&pP->acc[0], (REAL)BATCH_X(cpL, DOUBLE, i) * BATCH_X(cpR, DOUBLE, i));
+			CompensatedAdd(&pP->acc[0], (REAL)BATCH_Y(cpL, DOUBLE, i) * BATCH_Y(cpR, DOUBLE, i));
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+static void TotalChunk(void* pContext, size_t chunk)
+{
+	REDUCTION_CONTEXT* const pCtx = (REDUCTION_CONTEXT*)pContext;
+	PVECTOR_BATCH const      cpB  = pCtx->cpLHB;
+	PARTIAL* const           pP   = &pCtx->pPartials[chunk];
+
+	const size_t first = chunk * VECTOR_PARALLEL_CHUNK;
+	const size_t last  = first + VECTOR_PARALLEL_CHUNK < cpB->size ? first + VECTOR_PARALLEL_CHUNK : cpB->size;
+	switch (cpB->type)
+	{
+	case VECTOR_INTEGRAL:
+		for (size_t i = first; i < last; ++i)
+		{
+			pP->exact[0] += (unsigned long long)BATCH_X(cpB, INT, i);
+			pP->exact[1] += (unsigned long long)BATCH_Y(cpB, INT, i);
+		}
+		break;
+
+	case VECTOR_REAL:
+		for (size_t i = first; i < last; ++i)
+		{
+			CompensatedAdd(&pP->acc[0], BATCH_X(cpB, REAL, i));
+			CompensatedAdd(&pP->acc[1], BATCH_Y(cpB, REAL, i));
+		}
+		break;
+
+	case VECTOR_COMPLEX:
+		for (size_t i = first; i < last; ++i)
+		{
+			CompensatedAdd(&pP->acc[0], creall(BATCH_X(cpB, COMPLEX, i)));
+			CompensatedAdd(&pP->acc[1], cimagl(BATCH_X(cpB, COMPLEX, i)));
+			CompensatedAdd(&pP->acc[2], creall(BATCH_Y(cpB, COMPLEX, i)));
+			CompensatedAdd(&pP->acc[3], cimagl(BATCH_Y(cpB, COMPLEX, i)));
+		}
+		break;
+
+	case VECTOR_FLOAT:
+		for (size_t i = first; i < last; ++i)
+		{
+			CompensatedAdd(&pP->acc[0], BATCH_X(cpB, FLOAT, i));
+			CompensatedAdd(&pP->acc[1], BATCH_Y(cpB, FLOAT, i));
+		}
+		break;
+
+	case VECTOR_DOUBLE:
+		for (size_t i = first; i < last; ++i)
+		{
+			CompensatedAdd(&pP->acc[0], BATCH_X(cpB, DOUBLE, i));
+			CompensatedAdd(&pP->acc[1], BATCH_Y(cpB, DOUBLE, i));
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+///====================================================================================================================================
+/// <summary>   Runs reduction and combines the partials pairwise in chunk order into pPartials[0]. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. The tree shape depends only on the number of chunks, so the result is bit-identical for any pool. </remarks>
+///
+/// <param name="pPool">	Pool or NULL. </param>
+/// <param name="pfnTask">	Chunk task. </param>
+/// <param name="pCtx">		Context with the batches, pPartials is allocated here. </param>
+///
+/// <returns>	VECTOR_OK or VECTOR_E_NO_MEMORY. </returns>
+///====================================================================================================================================
+static int Reduce(PVECTOR_THREAD_POOL pPool, PFN_CHUNK_TASK pfnTask, REDUCTION_CONTEXT* pCtx)
+{
+	const size_t nChunks = pCtx->cpLHB->size ? (pCtx->cpLHB->size + VECTOR_PARALLEL_CHUNK - 1) / VECTOR_PARALLEL_CHUNK : 1;
+
+	pCtx->pPartials = (PARTIAL*)calloc(nChunks, sizeof(PARTIAL));
+	if (!pCtx->pPartials)
+		return VECTOR_E_NO_MEMORY;
+
+	RunJob(pPool, pfnTask, pCtx, nChunks);
+
+	for (size_t step = 1; step < nChunks; step *= 2)
+		for (size_t i = 0; i + step < nChunks; i += 2 * step)
+		{
+			PARTIAL* const       pDst = &pCtx->pPartials[i];
+			PARTIAL const* const cpSrc = &pCtx->pPartials[i + step];
+			for (size_t j = 0; j < 4; ++j)
+				CompensatedMerge(&pDst->acc[j], &cpSrc->acc[j]);
+
+			pDst->exact[0] += cpSrc->exact[0];
+			pDst->exact[1] += cpSrc->exact[1];
+		}
+
+	return VECTOR_OK;
+}
+
+int ParallelDotProduct(PVECTOR_THREAD_POOL pPool, const PVECTOR_BATCH cpLHB, const PVECTOR_BATCH cpRHB, REAL* pResult)
+{
+	if (!cpLHB || !cpRHB || !pResult)
+		return VECTOR_E_INVALID_ARG;
+
+	if (cpLHB->type != cpRHB->type || cpLHB->size != cpRHB->size)
+		return VECTOR_E_TYPE_MISMATCH;
+
+	if (cpLHB->type < 0 || cpLHB->type >= VECTOR_TYPE_COUNT)
+		return VECTOR_E_UNKNOWN_TYPE;
+
+	REDUCTION_CONTEXT ctx = { cpLHB, cpRHB, NULL };
+
+	const int status = Reduce(pPool, DotProductChunk, &ctx);
+	if (status == VECTOR_OK)
+		*pResult = cpLHB->type == VECTOR_INTEGRAL ? (REAL)(long long)ctx.pPartials->exact[0] : CompensatedResult(&ctx.pPartials->acc[0]);
+
+	free(ctx.pPartials);
+
+	return status;
+}
+
+int ParallelBatchTotal(PVECTOR_THREAD_POOL pPool, const PVECTOR_BATCH cpBatch, void* pX, void* pY)
+{
+	if (!cpBatch || !pX || !pY)
+		return VECTOR_E_INVALID_ARG;
+
+	if (cpBatch->type < 0 || cpBatch->type >= VECTOR_TYPE_COUNT)
+		return VECTOR_E_UNKNOWN_TYPE;
+
+	REDUCTION_CONTEXT ctx = { cpBatch, NULL, NULL };
+
+	const int status = Reduce(pPool, TotalChunk, &ctx);
+	if (status == VECTOR_OK)
+	{
+		const PARTIAL* const cpP = ctx.pPartials;
+		switch (cpBatch->type)
+		{
+		case VECTOR_INTEGRAL:
+			*(INT*)pX = (INT)(unsigned)cpP->exact[0];
+			*(INT*)pY = (INT)(unsigned)cpP->exact[1];
+			break;
+
+		case VECTOR_REAL:
+			*(REAL*)pX = CompensatedResult(&cpP->acc[0]);
+			*(REAL*)pY = CompensatedResult(&cpP->acc[1]);
+			break;
+
+		case VECTOR_COMPLEX:
+			*(COMPLEX*)pX = _LCOMPLEX_(CompensatedResult(&cpP->acc[0]), CompensatedResult(&cpP->acc[1]));
+			*(COMPLEX*)pY = _LCOMPLEX_(CompensatedResult(&cpP->acc[2]), CompensatedResult(&cpP->acc[3]));
+			break;
+
+		case VECTOR_FLOAT:
+			*(FLOAT*)pX = (FLOAT)CompensatedResult(&cpP->acc[0]);
+			*(FLOAT*)pY = (FLOAT)CompensatedResult(&cpP->acc[1]);
+			break;
+
+		case VECTOR_DOUBLE:
+			*(DOUBLE*)pX = (DOUBLE)CompensatedResult(&cpP->acc[0]);
+			*(DOUBLE*)pY = (DOUBLE)CompensatedResult(&cpP->acc[1]);
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	free(ctx.pPartials);
+
+	return status;
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+///====================================================================================================================================
+/// File:				VectorParallel.h
+/// Author:				MyLibh
+/// Created:			17.10.2026
+///
+/// Last modified by:	MyLibh
+/// Last modified on:	17.10.2026
+///====================================================================================================================================
+/// Copyright(c) MyLibh. All rights reserved.
+///====================================================================================================================================
+
+#ifndef __VECTORPARALLEL_H_INCLUDED__
+#define __VECTORPARALLEL_H_INCLUDED__
+
+#include "VectorBatch.h"
+
+/// [url] https://en.cppreference.com/w/c/types/size_t [/url]
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+///====================================================================================================================================
+/// <summary>
+/// 	Number of vectors reduced by one task. The split depends only on the batch size, so the results don't depend on the number of
+/// 	threads.
+/// </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+#define VECTOR_PARALLEL_CHUNK 16384
+
+///====================================================================================================================================
+/// <summary>   Pool of worker threads. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+typedef struct _VectorThreadPool VECTOR_THREAD_POOL, *PVECTOR_THREAD_POOL;
+
+///====================================================================================================================================
+/// <summary>   Creates thread pool. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. The calling thread takes part in the work, so nThreads - 1 workers are started. </remarks>
+///
+/// <param name="nThreads"> Number of threads, 0 for the number of processors. </param>
+///
+/// <returns>	New pool or NULL. </returns>
+///====================================================================================================================================
+PVECTOR_THREAD_POOL CreateVectorThreadPool(size_t nThreads);
+
+///====================================================================================================================================
+/// <summary>   Stops the workers and deletes thread pool. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="pPool"> Pool for deleting. </param>
+///====================================================================================================================================
+void DeleteVectorThreadPool(PVECTOR_THREAD_POOL pPool);
+
+///====================================================================================================================================
+/// <summary>   Gets number of threads of the pool including the calling one. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="cpPool"> Pool or NULL. </param>
+///
+/// <returns>	Number of threads. </returns>
+///====================================================================================================================================
+size_t GetThreadPoolSize(const PVECTOR_THREAD_POOL cpPool);
+
+///====================================================================================================================================
+/// <summary>   Calculates sum of the scalar products of the corresponding vectors of two batches in parallel. </summary>
+///
+/// <remarks>
+/// 	MyLibh, 17.10.2026. Floating-point products are summed with Neumaier compensation inside the chunks and pairwise across them,
+/// 	integer ones exactly in 64 bits.
+/// </remarks>
+///
+/// <param name="pPool">	Pool or NULL to run on the calling thread. </param>
+/// <param name="cpLHB">	Batch. </param>
+/// <param name="cpRHB">	Batch of the same type and size. </param>
+/// <param name="pResult">	Sum of the scalar products. </param>
+///
+/// <returns>	VECTOR_OK or error code. </returns>
+///====================================================================================================================================
+int ParallelDotProduct(PVECTOR_THREAD_POOL pPool, const PVECTOR_BATCH cpLHB, const PVECTOR_BATCH cpRHB, REAL* pResult);
+
+///====================================================================================================================================
+/// <summary>   Calculates sum of all vectors of the batch in parallel. </summary>
+///
+/// <remarks>
+/// 	MyLibh, 17.10.2026. Floating-point components are summed like in ParallelDotProduct, INT ones wrap around like in Sum.
+/// </remarks>
+///
+/// <param name="pPool">	Pool or NULL to run on the calling thread. </param>
+/// <param name="cpBatch">	Batch. </param>
+/// <param name="pX">		Storage of the component type for x-component of the sum. </param>
+/// <param name="pY">		Storage of the component type for y-component of the sum. </param>
+///
+/// <returns>	VECTOR_OK or error code. </returns>
+///====================================================================================================================================
+int ParallelBatchTotal(PVECTOR_THREAD_POOL pPool, const PVECTOR_BATCH cpBatch, void* pX, void* pY);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __VECTORPARALLEL_H_INCLUDED__ */
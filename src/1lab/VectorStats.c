@@ -0,0 +1,363 @@
+// This is a personal academic project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+#include "VectorStats.h"
+
+/// [url] https://en.cppreference.com/w/cpp/header/cstdlib [/url]
+#include <stdlib.h>
+/// [url] https://en.cppreference.com/w/cpp/header/cstring [/url]
+#include <string.h>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+/// [url] https://docs.microsoft.com/en-us/cpp/intrinsics/rdtsc?view=vs-2019 [/url]
+#include <intrin.h>
+#define VECTOR_HAS_RDTSC
+#elif defined(__x86_64__) || defined(__i386__)
+/// [url] https://gcc.gnu.org/onlinedocs/gcc/x86-Built-in-Functions.html [/url]
+#include <x86intrin.h>
+#define VECTOR_HAS_RDTSC
+#else
+/// [url] https://en.cppreference.com/w/c/chrono/timespec_get [/url]
+#include <time.h>
+#endif
+
+unsigned long long GetVectorTicks(void)
+{
+#ifdef VECTOR_HAS_RDTSC
+	return __rdtsc();
+#else
+	struct timespec now;
+	timespec_get(&now, TIME_UTC);
+
+	return (unsigned long long)now.tv_sec * 1000000000ull + (unsigned long long)now.tv_nsec;
+#endif /* VECTOR_HAS_RDTSC */
+}
+
+#ifdef VECTOR_ENABLE_STATS
+
+#ifdef _WIN32
+/// [url] https://docs.microsoft.com/en-us/windows/win32/procthread/fibers [/url]
+#include <windows.h>
+#else
+/// [url] https://pubs.opengroup.org/onlinepubs/9699919799/basedefs/pthread.h.html [/url]
+#include <pthread.h>
+#endif /* _WIN32 */
+
+#ifdef _MSC_VER
+/// [url] https://docs.microsoft.com/en-us/cpp/intrinsics/iso-volatile-load-store?view=vs-2019 [/url]
+#include <intrin.h>
+
+#define VECTOR_THREAD_LOCAL __declspec(thread)
+#define CompareExchangePointer(ppDst, pNew, pOld) _InterlockedCompareExchangePointer((void* volatile*)(ppDst), pNew, pOld)
+#define LoadPointer(ppSrc)                        _InterlockedCompareExchangePointer((void* volatile*)(ppSrc), NULL, NULL)
+#define StorePointer(ppDst, p)                    ((void)_InterlockedExchangePointer((void* volatile*)(ppDst), (void*)(p)))
+#define CompareExchangeFlag(pDst, value, old)     _InterlockedCompareExchange(pDst, value, old)
+#define StoreFlag(pDst, value)                    ((void)_InterlockedExchange(pDst, value))
+
+static void AtomicAdd(unsigned long long volatile* pDst, unsigned long long value)
+{
+	__int64 old;
+	do
+	{
+		old = (__int64)*pDst;
+	} while (_InterlockedCompareExchange64((__int64 volatile*)pDst, old + (__int64)value, old) != old);
+}
+
+static unsigned long long AtomicLoad(unsigned long long volatile* pSrc)
+{
+	return (unsigned long long)_InterlockedCompareExchange64((__int64 volatile*)pSrc, 0, 0);
+}
+
+static void AtomicStore(unsigned long long volatile* pDst, unsigned long long value)
+{
+	(void)_InterlockedExchange64((__int64 volatile*)pDst, (__int64)value);
+}
+
+static void RelaxedAdd(unsigned long long volatile* pDst, unsigned long long value)
+{
+	__iso_volatile_store64((__int64 volatile*)pDst, __iso_volatile_load64((__int64 const volatile*)pDst) + (__int64)value);
+}
+
+// Interlocked functions are full barriers
+#define AcquireLoad(pSrc)         AtomicLoad(pSrc)
+#define ReleaseStore(pDst, value) AtomicStore(pDst, value)
+#else
+#define VECTOR_THREAD_LOCAL _Thread_local
+#define CompareExchangePointer(ppDst, pNew, pOld) __sync_val_compare_and_swap(ppDst, pOld, pNew)
+#define LoadPointer(ppSrc)                        __atomic_load_n(ppSrc, __ATOMIC_ACQUIRE)
+#define StorePointer(ppDst, p)                    __atomic_store_n(ppDst, p, __ATOMIC_RELEASE)
+#define CompareExchangeFlag(pDst, value, old)     __sync_val_compare_and_swap(pDst, old, value)
+#define StoreFlag(pDst, value)                    __atomic_store_n(pDst, value, __ATOMIC_RELEASE)
+#define AtomicAdd(pDst, value)                    ((void)__atomic_fetch_add(pDst, value, __ATOMIC_RELAXED))
+#define AtomicLoad(pSrc)                          __atomic_load_n(pSrc, __ATOMIC_RELAXED)
+#define AtomicStore(pDst, value)                  __atomic_store_n(pDst, value, __ATOMIC_RELAXED)
+#define RelaxedAdd(pDst, value)                   AtomicStore(pDst, AtomicLoad(pDst) + (value))
+#define AcquireLoad(pSrc)                         __atomic_load_n(pSrc, __ATOMIC_ACQUIRE)
+#define ReleaseStore(pDst, value)                 __atomic_store_n(pDst, value, __ATOMIC_RELEASE)
+#endif /* _MSC_VER */
+
+///====================================================================================================================================
+/// <summary>   Counters of one thread. </summary>
+///
+/// <remarks>
+/// 	MyLibh, 17.10.2026. Blocks are never freed, a finished thread gives its block up and the next new thread takes it over, so the
+/// 	list is as long as the most threads ever counting at once and counters of finished threads stay in the totals. Only the owner
+/// 	writes the counters, so it updates them with a plain load and store instead of a locked add. ResetVectorStats leaves them
+/// 	alone and moves the baseline the totals are counted from instead.
+/// </remarks>
+///====================================================================================================================================
+
+typedef struct _ThreadStats
+{
+	VECTOR_STATS         stats;
+	VECTOR_STATS         baseline;
+	struct _ThreadStats* pNext;
+	long volatile        owned;
+} THREAD_STATS;
+
+static THREAD_STATS* volatile            s_pThreadStats  = NULL;
+static VECTOR_THREAD_LOCAL THREAD_STATS* s_pCurrent      = NULL;
+static PFN_VECTOR_TRACE_HOOK volatile    s_pfnTraceHook  = NULL;
+static void* volatile                    s_pTraceContext = NULL;
+
+// Counters of threads that couldn't get their own block go here, they are shared and added to atomically
+static THREAD_STATS s_fallback;
+
+///====================================================================================================================================
+/// <summary>   Gives the block of the finishing thread up. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. Called on the finishing thread by the thread-exit hook of the OS. </remarks>
+///
+/// <param name="pStats">	Block of the thread. </param>
+///====================================================================================================================================
+static void ReleaseThreadStats(void* pStats)
+{
+	if (pStats)
+	{
+		s_pCurrent = NULL;
+		StoreFlag(&((THREAD_STATS*)pStats)->owned, 0);
+	}
+}
+
+#ifdef _WIN32
+static INIT_ONCE s_exitHookOnce = INIT_ONCE_STATIC_INIT;
+static DWORD     s_exitHook     = FLS_OUT_OF_INDEXES;
+
+static VOID NTAPI OnThreadExit(PVOID pStats)
+{
+	ReleaseThreadStats(pStats);
+}
+
+static BOOL CALLBACK CreateExitHook(PINIT_ONCE pOnce, PVOID pParameter, PVOID* ppContext)
+{
+	(void)pOnce;
+	(void)pParameter;
+	(void)ppContext;
+
+	s_exitHook = FlsAlloc(OnThreadExit);
+
+	return TRUE;
+}
+
+static void WatchThreadExit(THREAD_STATS* pStats)
+{
+	InitOnceExecuteOnce(&s_exitHookOnce, CreateExitHook, NULL, NULL);
+	if (s_exitHook != FLS_OUT_OF_INDEXES)
+		FlsSetValue(s_exitHook, pStats);
+}
+#else
+static pthread_once_t s_exitHookOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t  s_exitHook;
+static int            s_exitHookCreated = 0;
+
+static void CreateExitHook(void)
+{
+	s_exitHookCreated = !pthread_key_create(&s_exitHook, ReleaseThreadStats);
+}
+
+static void WatchThreadExit(THREAD_STATS* pStats)
+{
+	pthread_once(&s_exitHookOnce, CreateExitHook);
+	if (s_exitHookCreated)
+		pthread_setspecific(s_exitHook, pStats);
+}
+#endif /* _WIN32 */
+
+static VECTOR_STATS* GetThreadStats(void)
+{
+	if (!s_pCurrent)
+	{
+		THREAD_STATS* pStats = NULL;
+		for (THREAD_STATS* pThread = (THREAD_STATS*)LoadPointer(&s_pThreadStats); pThread && !pStats; pThread = pThread->pNext)
+			if (!CompareExchangeFlag(&pThread->owned, 1, 0))
+				pStats = pThread;
+
+		if (!pStats)
+		{
+			pStats = (THREAD_STATS*)calloc(1, sizeof(THREAD_STATS));
+			if (!pStats)
+				return &s_fallback.stats;
+
+			pStats->owned = 1;
+
+			THREAD_STATS* pHead;
+			do
+			{
+				pHead         = (THREAD_STATS*)LoadPointer(&s_pThreadStats);
+				pStats->pNext = pHead;
+			} while (CompareExchangePointer(&s_pThreadStats, pStats, pHead) != pHead);
+		}
+
+		s_pCurrent = pStats;
+		WatchThreadExit(pStats);
+	}
+
+	return &s_pCurrent->stats;
+}
+
+static void Count(const VECTOR_STATS* cpStats, unsigned long long volatile* pCounter, unsigned long long value)
+{
+	if (cpStats == &s_fallback.stats)
+		AtomicAdd(pCounter, value);
+	else
+		RelaxedAdd(pCounter, value);
+}
+
+void StatsOnAlloc(size_t cb)
+{
+	VECTOR_STATS* pStats = GetThreadStats();
+	Count(pStats, &pStats->allocations, 1);
+	Count(pStats, &pStats->bytesAllocated, cb);
+}
+
+void StatsOnFree(size_t cb)
+{
+	VECTOR_STATS* pStats = GetThreadStats();
+	Count(pStats, &pStats->frees, 1);
+	Count(pStats, &pStats->bytesFreed, cb);
+}
+
+void StatsOnOpBegin(VECTOR_OP_SCOPE* pScope, int op, int type)
+{
+	VECTOR_STATS* pStats = GetThreadStats();
+	Count(pStats, &pStats->operations[op][type], 1);
+
+	pScope->op    = op;
+	pScope->type  = type;
+	pScope->start = LoadPointer(&s_pfnTraceHook) ? GetVectorTicks() : 0;
+}
+
+void StatsOnOpEnd(const VECTOR_OP_SCOPE* cpScope)
+{
+	const PFN_VECTOR_TRACE_HOOK pfnHook = (PFN_VECTOR_TRACE_HOOK)LoadPointer(&s_pfnTraceHook);
+	if (cpScope->start && pfnHook)
+	{
+		const unsigned long long ticks  = GetVectorTicks() - cpScope->start;
+		VECTOR_STATS*            pStats = GetThreadStats();
+
+		Count(pStats, &pStats->ticks[cpScope->op], ticks);
+		pfnHook(cpScope->op, cpScope->type, ticks, LoadPointer(&s_pTraceContext));
+	}
+}
+
+///====================================================================================================================================
+/// <summary>   Gets counter value since the last reset. </summary>
+///
+/// <remarks>
+/// 	MyLibh, 17.10.2026. The baseline is loaded first: ResetVectorStats stores it after loading the counter, so the counter is
+/// 	seen at least at the baseline and the difference can't wrap around.
+/// </remarks>
+///
+/// <param name="pCounter">		Counter. </param>
+/// <param name="pBaseline">	Its baseline. </param>
+///
+/// <returns>	Counted value. </returns>
+///====================================================================================================================================
+static unsigned long long CountedSinceReset(unsigned long long volatile* pCounter, unsigned long long volatile* pBaseline)
+{
+	const unsigned long long baseline = AcquireLoad(pBaseline);
+
+	return AtomicLoad(pCounter) - baseline;
+}
+
+static void AddStats(VECTOR_STATS* pTotal, THREAD_STATS* pThread)
+{
+	VECTOR_STATS* pStats    = &pThread->stats;
+	VECTOR_STATS* pBaseline = &pThread->baseline;
+
+	pTotal->allocations    += CountedSinceReset(&pStats->allocations, &pBaseline->allocations);
+	pTotal->frees          += CountedSinceReset(&pStats->frees, &pBaseline->frees);
+	pTotal->bytesAllocated += CountedSinceReset(&pStats->bytesAllocated, &pBaseline->bytesAllocated);
+	pTotal->bytesFreed     += CountedSinceReset(&pStats->bytesFreed, &pBaseline->bytesFreed);
+
+	for (size_t op = 0; op < VECTOR_OP_COUNT; ++op)
+	{
+		for (size_t type = 0; type < VECTOR_TYPE_COUNT; ++type)
+			pTotal->operations[op][type] += CountedSinceReset(&pStats->operations[op][type], &pBaseline->operations[op][type]);
+
+		pTotal->ticks[op] += CountedSinceReset(&pStats->ticks[op], &pBaseline->ticks[op]);
+	}
+}
+
+static void MoveBaseline(THREAD_STATS* pThread)
+{
+	VECTOR_STATS* pStats    = &pThread->stats;
+	VECTOR_STATS* pBaseline = &pThread->baseline;
+
+	ReleaseStore(&pBaseline->allocations, AtomicLoad(&pStats->allocations));
+	ReleaseStore(&pBaseline->frees, AtomicLoad(&pStats->frees));
+	ReleaseStore(&pBaseline->bytesAllocated, AtomicLoad(&pStats->bytesAllocated));
+	ReleaseStore(&pBaseline->bytesFreed, AtomicLoad(&pStats->bytesFreed));
+
+	for (size_t op = 0; op < VECTOR_OP_COUNT; ++op)
+	{
+		for (size_t type = 0; type < VECTOR_TYPE_COUNT; ++type)
+			ReleaseStore(&pBaseline->operations[op][type], AtomicLoad(&pStats->operations[op][type]));
+
+		ReleaseStore(&pBaseline->ticks[op], AtomicLoad(&pStats->ticks[op]));
+	}
+}
+
+void GetVectorStats(VECTOR_STATS* pStats)
+{
+	memset(pStats, 0, sizeof(VECTOR_STATS));
+
+	AddStats(pStats, &s_fallback);
+	for (THREAD_STATS* pThread = (THREAD_STATS*)LoadPointer(&s_pThreadStats); pThread; pThread = pThread->pNext)
+		AddStats(pStats, pThread);
+
+	// An object may be freed by another thread than the one that created it, so the balance is only meaningful in total
+	pStats->liveObjects = (long long)(pStats->allocations - pStats->frees);
+	pStats->liveBytes   = (long long)(pStats->bytesAllocated - pStats->bytesFreed);
+}
+
+void ResetVectorStats(void)
+{
+	MoveBaseline(&s_fallback);
+	for (THREAD_STATS* pThread = (THREAD_STATS*)LoadPointer(&s_pThreadStats); pThread; pThread = pThread->pNext)
+		MoveBaseline(pThread);
+}
+
+void SetVectorTraceHook(PFN_VECTOR_TRACE_HOOK pfnHook, void* pContext)
+{
+	StorePointer(&s_pTraceContext, pContext);
+	StorePointer(&s_pfnTraceHook, pfnHook);
+}
+
+#else
+
+void GetVectorStats(VECTOR_STATS* pStats)
+{
+	memset(pStats, 0, sizeof(VECTOR_STATS));
+}
+
+void ResetVectorStats(void)
+{ }
+
+void SetVectorTraceHook(PFN_VECTOR_TRACE_HOOK pfnHook, void* pContext)
+{
+	(void)pfnHook;
+	(void)pContext;
+}
+
+#endif /* VECTOR_ENABLE_STATS */
@@ -0,0 +1,139 @@
+#pragma once
+
+///====================================================================================================================================
+/// File:				VectorStats.h
+/// Author:				MyLibh
+/// Created:			17.10.2026
+///
+/// Last modified by:	MyLibh
+/// Last modified on:	17.10.2026
+///====================================================================================================================================
+/// Copyright(c) MyLibh. All rights reserved.
+///====================================================================================================================================
+
+#ifndef __VECTORSTATS_H_INCLUDED__
+#define __VECTORSTATS_H_INCLUDED__
+
+#include "Vector.h"
+
+/// [url] https://en.cppreference.com/w/c/types/size_t [/url]
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#define VECTOR_OP_ADD            0x0
+#define VECTOR_OP_SUB            0x1
+#define VECTOR_OP_SCALE          0x2
+#define VECTOR_OP_FMA            0x3
+#define VECTOR_OP_SCALAR_PRODUCT 0x4
+
+#define VECTOR_OP_COUNT 5
+
+///====================================================================================================================================
+/// <summary>   Counters of the Vector library. </summary>
+///
+/// <remarks>
+/// 	MyLibh, 17.10.2026. Every heap allocation of the library is counted: vectors, batches and their components, arenas and their
+/// 	blocks, and file mapping records. Mapped file views aren't heap and aren't counted. Vectors placed in an arena take no
+/// 	allocation of their own. ticks are gathered only while a trace hook is set.
+/// </remarks>
+///====================================================================================================================================
+
+typedef struct _VectorStats
+{
+	unsigned long long allocations;
+	unsigned long long frees;
+	unsigned long long bytesAllocated;
+	unsigned long long bytesFreed;
+	long long          liveObjects;
+	long long          liveBytes;
+	unsigned long long operations[VECTOR_OP_COUNT][VECTOR_TYPE_COUNT];
+	unsigned long long ticks[VECTOR_OP_COUNT];
+} VECTOR_STATS;
+
+///====================================================================================================================================
+/// <summary>   Trace hook called after every operation with its duration in GetVectorTicks units. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+typedef void (*PFN_VECTOR_TRACE_HOOK)(int op, int type, unsigned long long ticks, void* pContext);
+
+///====================================================================================================================================
+/// <summary>   Gets counters summed over all threads. </summary>
+///
+/// <remarks>
+/// 	MyLibh, 17.10.2026. Counters are read one by one while other threads may go on counting, so the snapshot is only consistent
+/// 	once they are idle. Without VECTOR_ENABLE_STATS all counters are 0.
+/// </remarks>
+///
+/// <param name="pStats">	Snapshot. </param>
+///====================================================================================================================================
+void GetVectorStats(VECTOR_STATS* pStats);
+
+///====================================================================================================================================
+/// <summary>   Starts counting from 0 again. Operations running meanwhile may be counted either before or after. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+void ResetVectorStats(void);
+
+///====================================================================================================================================
+/// <summary>   Sets trace hook. Does nothing without VECTOR_ENABLE_STATS. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="pfnHook">	Hook or NULL to stop tracing. </param>
+/// <param name="pContext">	Context passed to the hook. </param>
+///====================================================================================================================================
+void SetVectorTraceHook(PFN_VECTOR_TRACE_HOOK pfnHook, void* pContext);
+
+///====================================================================================================================================
+/// <summary>   Gets cheap timestamp for timing, CPU cycles on x86 and nanoseconds elsewhere. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <returns>	Timestamp. </returns>
+///====================================================================================================================================
+unsigned long long GetVectorTicks(void);
+
+#ifdef VECTOR_ENABLE_STATS
+
+///====================================================================================================================================
+/// <summary>   State of the operation being counted. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+
+typedef struct _VectorOpScope
+{
+	int                op;
+	int                type;
+	unsigned long long start;
+} VECTOR_OP_SCOPE;
+
+void StatsOnAlloc(size_t cb);
+void StatsOnFree(size_t cb);
+void StatsOnOpBegin(VECTOR_OP_SCOPE* pScope, int op, int type);
+void StatsOnOpEnd(const VECTOR_OP_SCOPE* cpScope);
+
+#define VECTOR_STATS_ALLOC(cb)          StatsOnAlloc(cb)
+#define VECTOR_STATS_FREE(cb)           StatsOnFree(cb)
+#define VECTOR_STATS_OP_BEGIN(op, type) VECTOR_OP_SCOPE _opScope; StatsOnOpBegin(&_opScope, op, type)
+#define VECTOR_STATS_OP_END()           StatsOnOpEnd(&_opScope)
+
+#else
+
+#define VECTOR_STATS_ALLOC(cb)          ((void)0)
+#define VECTOR_STATS_FREE(cb)           ((void)0)
+#define VECTOR_STATS_OP_BEGIN(op, type) ((void)0)
+#define VECTOR_STATS_OP_END()           ((void)0)
+
+#endif /* VECTOR_ENABLE_STATS */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __VECTORSTATS_H_INCLUDED__ */
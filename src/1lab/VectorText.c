@@ -0,0 +1,714 @@
+// This is a personal academic project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+#include "VectorText.h"
+
+/// [url] https://en.cppreference.com/w/cpp/header/cstdio [/url]
+#include <stdio.h>
+/// [url] https://en.cppreference.com/w/cpp/header/cstdlib [/url]
+#include <stdlib.h>
+/// [url] https://en.cppreference.com/w/cpp/header/cstring [/url]
+#include <string.h>
+/// [url] https://en.cppreference.com/w/cpp/header/cmath [/url]
+#include <math.h>
+/// [url] https://en.cppreference.com/w/cpp/header/cfloat [/url]
+#include <float.h>
+/// [url] https://en.cppreference.com/w/cpp/header/clocale [/url]
+#include <locale.h>
+
+///====================================================================================================================================
+/// <summary>   Upper bound of the length of one line, the buffer is flushed when less space is left. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+#define VECTOR_TEXT_MAX_LINE 256
+
+///====================================================================================================================================
+/// <summary>   The C locale, so that the decimal point is '.' whatever LC_NUMERIC the program runs with. </summary>
+///
+/// <remarks>
+/// 	MyLibh, 17.10.2026. MSVC takes the locale in every call, elsewhere it is made current for the calling thread only.
+/// </remarks>
+///====================================================================================================================================
+
+#ifdef _MSC_VER
+typedef struct _TextLocale
+{
+	_locale_t c;
+} TEXT_LOCALE;
+
+#define PrintLongDouble(p, cb, digits, value, cpLocale) _snprintf_l(p, cb, "%.*Lg", (cpLocale)->c, digits, value)
+#define PrintDouble(p, cb, digits, value, cpLocale)     _snprintf_l(p, cb, "%.*g", (cpLocale)->c, digits, value)
+#define ParseFloat(cp, ppEnd, cpLocale)                 _strtof_l(cp, ppEnd, (cpLocale)->c)
+#define ParseDouble(cp, ppEnd, cpLocale)                _strtod_l(cp, ppEnd, (cpLocale)->c)
+#define ParseLongDouble(cp, ppEnd, cpLocale)            _strtold_l(cp, ppEnd, (cpLocale)->c)
+#else
+typedef struct _TextLocale
+{
+	locale_t c;
+	locale_t previous;
+} TEXT_LOCALE;
+
+#define PrintLongDouble(p, cb, digits, value, cpLocale) ((void)(cpLocale), snprintf(p, cb, "%.*Lg", digits, value))
+#define PrintDouble(p, cb, digits, value, cpLocale)     ((void)(cpLocale), snprintf(p, cb, "%.*g", digits, value))
+#define ParseFloat(cp, ppEnd, cpLocale)                 ((void)(cpLocale), strtof(cp, ppEnd))
+#define ParseDouble(cp, ppEnd, cpLocale)                ((void)(cpLocale), strtod(cp, ppEnd))
+#define ParseLongDouble(cp, ppEnd, cpLocale)            ((void)(cpLocale), strtold(cp, ppEnd))
+#endif /* _MSC_VER */
+
+static int EnterCLocale(TEXT_LOCALE* pLocale)
+{
+#ifdef _MSC_VER
+	pLocale->c = _create_locale(LC_NUMERIC, "C");
+
+	return pLocale->c != NULL;
+#else
+	pLocale->c = newlocale(LC_NUMERIC_MASK, "C", (locale_t)0);
+	if (!pLocale->c)
+		return 0;
+
+	pLocale->previous = uselocale(pLocale->c);
+
+	return 1;
+#endif /* _MSC_VER */
+}
+
+static void LeaveCLocale(TEXT_LOCALE* pLocale)
+{
+#ifdef _MSC_VER
+	_free_locale(pLocale->c);
+#else
+	uselocale(pLocale->previous);
+	freelocale(pLocale->c);
+#endif /* _MSC_VER */
+}
+
+// Powers of ten exact in double up to 1e22, and in float up to 1e10
+static const double SC_POW10[] =
+{
+	1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static const long double SC_POW10_REAL[] =
+{
+	1e0L,  1e1L,  1e2L,  1e3L,  1e4L,  1e5L,  1e6L,  1e7L,  1e8L,  1e9L,  1e10L, 1e11L,
+	1e12L, 1e13L, 1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L, 1e20L, 1e21L, 1e22L
+};
+
+// The short forms rely on every operation being rounded to its type, which excess precision would break
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+#define VECTOR_TEXT_EXACT_ARITHMETIC 1
+#else
+#define VECTOR_TEXT_EXACT_ARITHMETIC 0
+#endif /* FLT_EVAL_METHOD */
+
+static const char SC_DIGIT_PAIRS[] =
+	"00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+	"40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
+static FILE* OpenFile(const char* cpPath, const char* cpMode)
+{
+	FILE* pFile = NULL;
+#ifdef _MSC_VER
+	if (fopen_s(&pFile, cpPath, cpMode))
+		return NULL;
+#else
+	pFile = fopen(cpPath, cpMode);
+#endif /* _MSC_VER */
+
+	// The chunks are already large, stdio buffering would only add a copy
+	if (pFile)
+		setvbuf(pFile, NULL, _IONBF, 0);
+
+	return pFile;
+}
+
+///====================================================================================================================================
+/// <summary>   Formats integer two digits at a time. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="p">		Output. </param>
+/// <param name="value">	Value. </param>
+///
+/// <returns>	End of the output. </returns>
+///====================================================================================================================================
+static char* FormatInteger(char* p, long long value)
+{
+	char  digits[24];
+	char* pEnd   = digits + sizeof(digits);
+	char* pFirst = pEnd;
+
+	unsigned long long u = value < 0 ? 0ull - (unsigned long long)value : (unsigned long long)value;
+	while (u >= 100)
+	{
+		const size_t pair = (size_t)(u % 100) * 2;
+		u /= 100;
+
+		*--pFirst = SC_DIGIT_PAIRS[pair + 1];
+		*--pFirst = SC_DIGIT_PAIRS[pair];
+	}
+
+	if (u >= 10)
+	{
+		*--pFirst = SC_DIGIT_PAIRS[u * 2 + 1];
+		*--pFirst = SC_DIGIT_PAIRS[u * 2];
+	}
+	else
+		*--pFirst = (char)('0' + u);
+
+	if (value < 0)
+		*p++ = '-';
+
+	memcpy(p, pFirst, (size_t)(pEnd - pFirst));
+
+	return p + (pEnd - pFirst);
+}
+
+///====================================================================================================================================
+/// <summary>   Formats m / 10^k as a plain decimal. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="p">		Output. </param>
+/// <param name="m">		Digits. </param>
+/// <param name="k">		Number of digits after the point. </param>
+/// <param name="negative">	Whether the value is negative. </param>
+///
+/// <returns>	End of the output. </returns>
+///====================================================================================================================================
+static char* FormatDecimal(char* p, unsigned long long m, size_t k, int negative)
+{
+	char         digits[24];
+	const size_t count = (size_t)(FormatInteger(digits, (long long)m) - digits);
+
+	if (negative)
+		*p++ = '-';
+
+	if (count <= k)
+	{
+		*p++ = '0';
+		*p++ = '.';
+		memset(p, '0', k - count);
+		p += k - count;
+		memcpy(p, digits, count);
+
+		return p + count;
+	}
+
+	memcpy(p, digits, count - k);
+	p += count - k;
+	*p++ = '.';
+	memcpy(p, digits + count - k, k);
+
+	return p + k;
+}
+
+///====================================================================================================================================
+/// <summary>   Defines the formatter of TYPE values that writes them so that they are read back exactly. </summary>
+///
+/// <remarks>
+/// 	MyLibh, 17.10.2026. Whole values, the common case, take the integer path. Values that are m / 10^k after rounding to TYPE
+/// 	with m and 10^k exact in it are written as that decimal, the parser gets back the same rounded quotient. Only the rest goes
+/// 	through printf with enough digits for the round trip.
+/// </remarks>
+///====================================================================================================================================
+#define DEFINE_FORMAT_FLOATING(name, TYPE, mantissa, epsilon, pow10, maxPow, digits, PRINT)                                          \
+	static char* name(char* p, TYPE value, const TEXT_LOCALE* cpLocale)                                                             \
+	{                                                                                                                               \
+		const TYPE magnitude = value < 0 ? -value : value;                                                                          \
+		if (magnitude < (TYPE)9007199254740992.0 && magnitude == (TYPE)(long long)magnitude && (value != 0 || !signbit(value)))     \
+			return FormatInteger(p, (long long)value);                                                                              \
+                                                                                                                                    \
+		const TYPE limit = (TYPE)(1ull << ((mantissa) < 53 ? (mantissa) : 53));                                                     \
+		for (size_t k = 1; VECTOR_TEXT_EXACT_ARITHMETIC && k <= (maxPow); ++k)                                                     \
+		{                                                                                                                           \
+			const TYPE scaled = magnitude * (TYPE)(pow10)[k];                                                                       \
+			if (!(scaled < limit))                                                                                                  \
+				break;                                                                                                              \
+                                                                                                                                    \
+			const unsigned long long m = (unsigned long long)(scaled + (TYPE)0.5);                                                  \
+			const TYPE               d = scaled - (TYPE)m;                                                                          \
+			if ((d < 0 ? -d : d) <= scaled * 4 * (epsilon) && (TYPE)m / (TYPE)(pow10)[k] == magnitude)                             \
+				return FormatDecimal(p, m, k, signbit(value));                                                                      \
+		}                                                                                                                           \
+                                                                                                                                    \
+		return p + PRINT(p, VECTOR_TEXT_MAX_LINE / 4, digits, value, cpLocale);                                                     \
+	}
+
+DEFINE_FORMAT_FLOATING(FormatFloat, FLOAT, FLT_MANT_DIG, FLT_EPSILON, SC_POW10, 10, FLT_DECIMAL_DIG, PrintDouble)
+DEFINE_FORMAT_FLOATING(FormatDouble, DOUBLE, DBL_MANT_DIG, DBL_EPSILON, SC_POW10, 22, DBL_DECIMAL_DIG, PrintDouble)
+DEFINE_FORMAT_FLOATING(FormatReal, REAL, LDBL_MANT_DIG, LDBL_EPSILON, SC_POW10_REAL, 22, LDBL_DECIMAL_DIG, PrintLongDouble)
+
+///====================================================================================================================================
+/// <summary>   Formats the line of the i-th vector of the batch. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="p">		Output with at least VECTOR_TEXT_MAX_LINE bytes. </param>
+/// <param name="cpBatch">	Batch. </param>
+/// <param name="i">		Index of the vector. </param>
+/// <param name="cpLocale">	The C locale. </param>
+///
+/// <returns>	End of the output. </returns>
+///====================================================================================================================================
+static char* FormatLine(char* p, const PVECTOR_BATCH cpBatch, size_t i, const TEXT_LOCALE* cpLocale)
+{
+	switch (cpBatch->type)
+	{
+	case VECTOR_INTEGRAL:
+		p    = FormatInteger(p, BATCH_X(cpBatch, INT, i));
+		*p++ = ',';
+		p    = FormatInteger(p, BATCH_Y(cpBatch, INT, i));
+		break;
+
+	case VECTOR_REAL:
+		p    = FormatReal(p, BATCH_X(cpBatch, REAL, i), cpLocale);
+		*p++ = ',';
+		p    = FormatReal(p, BATCH_Y(cpBatch, REAL, i), cpLocale);
+		break;
+
+	case VECTOR_COMPLEX:
+		p    = FormatReal(p, creall(BATCH_X(cpBatch, COMPLEX, i)), cpLocale);
+		*p++ = ',';
+		p    = FormatReal(p, cimagl(BATCH_X(cpBatch, COMPLEX, i)), cpLocale);
+		*p++ = ',';
+		p    = FormatReal(p, creall(BATCH_Y(cpBatch, COMPLEX, i)), cpLocale);
+		*p++ = ',';
+		p    = FormatReal(p, cimagl(BATCH_Y(cpBatch, COMPLEX, i)), cpLocale);
+		break;
+
+	case VECTOR_FLOAT:
+		p    = FormatFloat(p, BATCH_X(cpBatch, FLOAT, i), cpLocale);
+		*p++ = ',';
+		p    = FormatFloat(p, BATCH_Y(cpBatch, FLOAT, i), cpLocale);
+		break;
+
+	case VECTOR_DOUBLE:
+		p    = FormatDouble(p, BATCH_X(cpBatch, DOUBLE, i), cpLocale);
+		*p++ = ',';
+		p    = FormatDouble(p, BATCH_Y(cpBatch, DOUBLE, i), cpLocale);
+		break;
+
+	default:
+		break;
+	}
+
+	*p++ = '\n';
+
+	return p;
+}
+
+int ExportVectorText(const char* cpPath, const PVECTOR_BATCH cpBatch)
+{
+	if (!cpPath || !cpBatch)
+		return VECTOR_E_INVALID_ARG;
+
+	if (!GetComponentSize(cpBatch->type))
+		return VECTOR_E_UNKNOWN_TYPE;
+
+	char* pBuffer = (char*)malloc(VECTOR_TEXT_CHUNK);
+	if (!pBuffer)
+		return VECTOR_E_NO_MEMORY;
+
+	TEXT_LOCALE locale;
+	if (!EnterCLocale(&locale))
+	{
+		free(pBuffer);
+
+		return VECTOR_E_NO_MEMORY;
+	}
+
+	FILE* pFile = OpenFile(cpPath, "wb");
+	if (!pFile)
+	{
+		LeaveCLocale(&locale);
+		free(pBuffer);
+
+		return VECTOR_E_IO;
+	}
+
+	int   succeeded = 1;
+	char* p         = pBuffer;
+	for (size_t i = 0; i < cpBatch->size && succeeded; ++i)
+	{
+		p = FormatLine(p, cpBatch, i, &locale);
+		if (pBuffer + VECTOR_TEXT_CHUNK - p < VECTOR_TEXT_MAX_LINE)
+		{
+			succeeded = fwrite(pBuffer, 1, (size_t)(p - pBuffer), pFile) == (size_t)(p - pBuffer);
+			p         = pBuffer;
+		}
+	}
+
+	if (succeeded && p != pBuffer)
+		succeeded = fwrite(pBuffer, 1, (size_t)(p - pBuffer), pFile) == (size_t)(p - pBuffer);
+
+	LeaveCLocale(&locale);
+	free(pBuffer);
+
+	return fclose(pFile) == 0 && succeeded ? VECTOR_OK : VECTOR_E_IO;
+}
+
+///====================================================================================================================================
+/// <summary>   Skips separators and checks that the line goes on. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="cp">	Position in the line. </param>
+///
+/// <returns>	Start of the next field or NULL if the line has ended. </returns>
+///====================================================================================================================================
+static const char* SkipSeparators(const char* cp)
+{
+	while (*cp == ',' || *cp == ' ' || *cp == '\t')
+		++cp;
+
+	return *cp && *cp != '\n' && *cp != '\r' ? cp : NULL;
+}
+
+static const char* ParseInteger(const char* cp, INT* pValue)
+{
+	const int negative = *cp == '-';
+	if (*cp == '-' || *cp == '+')
+		++cp;
+
+	if (*cp < '0' || *cp > '9')
+		return NULL;
+
+	unsigned long long u = 0;
+	for (; *cp >= '0' && *cp <= '9'; ++cp)
+	{
+		u = u * 10 + (unsigned)(*cp - '0');
+		if (u > 2147483648ull)
+			return NULL;
+	}
+
+	if (!negative && u > 2147483647ull)
+		return NULL;
+
+	*pValue = negative ? (INT)(0 - (long long)u) : (INT)u;
+
+	return cp;
+}
+
+///====================================================================================================================================
+/// <summary>   Splits plain decimal like "-12.5e3" into its digits and power of ten. </summary>
+///
+/// <remarks>
+/// 	MyLibh, 17.10.2026. Returns NULL for anything else, including more than 19 significant digits, hex and infinities, those are
+/// 	left to strtod.
+/// </remarks>
+///
+/// <param name="cp">			Start of the field. </param>
+/// <param name="pM">			Digits. </param>
+/// <param name="pExponent">	Power of ten. </param>
+/// <param name="pNegative">	Whether the value is negative. </param>
+///
+/// <returns>	End of the field or NULL. </returns>
+///====================================================================================================================================
+static const char* ParseDecimal(const char* cp, unsigned long long* pM, int* pExponent, int* pNegative)
+{
+	*pNegative = *cp == '-';
+	if (*cp == '-' || *cp == '+')
+		++cp;
+
+	unsigned long long m = 0;
+	int                significant = 0, exponent = 0, any = 0;
+	for (; *cp >= '0' && *cp <= '9'; ++cp, any = 1)
+	{
+		if (significant == 19)
+			return NULL;
+
+		m = m * 10 + (unsigned)(*cp - '0');
+		significant += m != 0;
+	}
+
+	if (*cp == '.')
+		for (++cp; *cp >= '0' && *cp <= '9'; ++cp, any = 1)
+		{
+			if (significant == 19)
+				return NULL;
+
+			m = m * 10 + (unsigned)(*cp - '0');
+			significant += m != 0;
+			--exponent;
+		}
+
+	if (!any)
+		return NULL;
+
+	if (*cp == 'e' || *cp == 'E')
+	{
+		const int negative = cp[1] == '-';
+		if (cp[1] == '-' || cp[1] == '+')
+			++cp;
+
+		if (cp[1] < '0' || cp[1] > '9')
+			return NULL;
+
+		int e = 0;
+		for (++cp; *cp >= '0' && *cp <= '9'; ++cp)
+			if (e < 10000)
+				e = e * 10 + (*cp - '0');
+
+		exponent += negative ? -e : e;
+	}
+
+	if ((*cp >= '0' && *cp <= '9') || ((*cp | 0x20) >= 'a' && (*cp | 0x20) <= 'z') || *cp == '.')
+		return NULL;
+
+	*pM        = m;
+	*pExponent = exponent;
+
+	return cp;
+}
+
+///====================================================================================================================================
+/// <summary>   Defines the conversion of m * 10^exponent to TYPE when both are exact in it. </summary>
+///
+/// <remarks>
+/// 	MyLibh, 17.10.2026. A single rounded operation then gives the correctly rounded value, the same strtod would return.
+/// </remarks>
+///====================================================================================================================================
+#define DEFINE_PARSE_SHORT(name, TYPE, mantissa, pow10, maxPow)                                                                      \
+	static int name(unsigned long long m, int exponent, int negative, REAL* pValue)                                                 \
+	{                                                                                                                               \
+		if (!VECTOR_TEXT_EXACT_ARITHMETIC || m >= 1ull << ((mantissa) < 63 ? (mantissa) : 63) ||                                  \
+			exponent < -(maxPow) || exponent > (maxPow))                                                                            \
+			return 0;                                                                                                               \
+                                                                                                                                    \
+		const TYPE value = exponent < 0 ? (TYPE)m / (TYPE)(pow10)[-exponent] : (TYPE)m * (TYPE)(pow10)[exponent];                 \
+		*pValue          = negative ? -value : value;                                                                               \
+                                                                                                                                    \
+		return 1;                                                                                                                   \
+	}
+
+DEFINE_PARSE_SHORT(ParseShortFloat, FLOAT, FLT_MANT_DIG, SC_POW10, 10)
+DEFINE_PARSE_SHORT(ParseShortDouble, DOUBLE, DBL_MANT_DIG, SC_POW10, 22)
+DEFINE_PARSE_SHORT(ParseShortReal, REAL, LDBL_MANT_DIG, SC_POW10_REAL, 22)
+
+///====================================================================================================================================
+/// <summary>   Parses count floating-point fields of the line. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="cp">		Start of the line. </param>
+/// <param name="type">		VECTOR_REAL, VECTOR_FLOAT or VECTOR_DOUBLE, the type of the parsed text. </param>
+/// <param name="pValues">	Values. </param>
+/// <param name="count">	Number of fields. </param>
+/// <param name="cpLocale">	The C locale. </param>
+///
+/// <returns>	End of the last field or NULL. </returns>
+///====================================================================================================================================
+static const char* ParseFloatingFields(const char* cp, int type, REAL* pValues, size_t count, const TEXT_LOCALE* cpLocale)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		cp = SkipSeparators(cp);
+		if (!cp)
+			return NULL;
+
+		unsigned long long m;
+		int                exponent, negative;
+		const char* const  cpEnd = ParseDecimal(cp, &m, &exponent, &negative);
+		if (cpEnd)
+		{
+			int parsed;
+			if (type == VECTOR_FLOAT)
+				parsed = ParseShortFloat(m, exponent, negative, &pValues[i]);
+			else if (type == VECTOR_DOUBLE)
+				parsed = ParseShortDouble(m, exponent, negative, &pValues[i]);
+			else
+				parsed = ParseShortReal(m, exponent, negative, &pValues[i]);
+
+			if (parsed)
+			{
+				cp = cpEnd;
+				continue;
+			}
+		}
+
+		char* pEnd = NULL;
+		if (type == VECTOR_FLOAT)
+			pValues[i] = ParseFloat(cp, &pEnd, cpLocale);
+		else if (type == VECTOR_DOUBLE)
+			pValues[i] = ParseDouble(cp, &pEnd, cpLocale);
+		else
+			pValues[i] = ParseLongDouble(cp, &pEnd, cpLocale);
+
+		if (pEnd == cp)
+			return NULL;
+
+		cp = pEnd;
+	}
+
+	return cp;
+}
+
+///====================================================================================================================================
+/// <summary>   Parses one line and appends the vector to the batch. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="cpLine">	Line terminated by '\n' or '\0'. </param>
+/// <param name="pBatch">	Batch. </param>
+/// <param name="cpLocale">	The C locale. </param>
+///
+/// <returns>	VECTOR_OK or error code. </returns>
+///====================================================================================================================================
+static int ParseLine(const char* cpLine, PVECTOR_BATCH pBatch, const TEXT_LOCALE* cpLocale)
+{
+	const char* cp = cpLine;
+	while (*cp == ' ' || *cp == '\t' || *cp == '\r')
+		++cp;
+
+	if (!*cp || *cp == '\n')
+		return VECTOR_OK;
+
+	int status = VECTOR_E_UNKNOWN_TYPE;
+	if (pBatch->type == VECTOR_INTEGRAL)
+	{
+		INT x, y;
+		cp = ParseInteger(cp, &x);
+		cp = cp ? SkipSeparators(cp) : NULL;
+		cp = cp ? ParseInteger(cp, &y) : NULL;
+		if (cp)
+			status = PushBackComponents(pBatch, &x, &y);
+	}
+	else
+	{
+		REAL values[4];
+		cp = ParseFloatingFields(cp, pBatch->type, values, pBatch->type == VECTOR_COMPLEX ? 4 : 2, cpLocale);
+		if (cp)
+			switch (pBatch->type)
+			{
+			case VECTOR_REAL:
+				status = PushBackComponents(pBatch, &values[0], &values[1]);
+				break;
+
+			case VECTOR_COMPLEX:
+			{
+				const COMPLEX x = _LCOMPLEX_(values[0], values[1]);
+				const COMPLEX y = _LCOMPLEX_(values[2], values[3]);
+				status = PushBackComponents(pBatch, &x, &y);
+				break;
+			}
+
+			case VECTOR_FLOAT:
+			{
+				const FLOAT x = (FLOAT)values[0], y = (FLOAT)values[1];
+				status = PushBackComponents(pBatch, &x, &y);
+				break;
+			}
+
+			case VECTOR_DOUBLE:
+			{
+				const DOUBLE x = (DOUBLE)values[0], y = (DOUBLE)values[1];
+				status = PushBackComponents(pBatch, &x, &y);
+				break;
+			}
+
+			default:
+				break;
+			}
+	}
+
+	if (!cp)
+		return VECTOR_E_BAD_FORMAT;
+
+	if (status != VECTOR_OK)
+		return status;
+
+	while (*cp == ' ' || *cp == '\t' || *cp == '\r' || *cp == ',')
+		++cp;
+
+	return !*cp || *cp == '\n' ? VECTOR_OK : VECTOR_E_BAD_FORMAT;
+}
+
+PVECTOR_BATCH ImportVectorText(const char* cpPath, int type, int* pStatus)
+{
+	int status = VECTOR_OK;
+
+	PVECTOR_BATCH pBatch  = NULL;
+	char*         pBuffer = NULL;
+	FILE*         pFile   = NULL;
+	TEXT_LOCALE   locale;
+	int           entered = 0;
+	if (!cpPath)
+		status = VECTOR_E_INVALID_ARG;
+	else if (!GetComponentSize(type))
+		status = VECTOR_E_UNKNOWN_TYPE;
+	else if (!(pBatch = CreateVectorBatch(type, 0)) || !(pBuffer = (char*)malloc(VECTOR_TEXT_CHUNK + 1)) || !(entered = EnterCLocale(&locale)))
+		status = VECTOR_E_NO_MEMORY;
+	else if (!(pFile = OpenFile(cpPath, "rb")))
+		status = VECTOR_E_IO;
+
+	size_t cbData = 0;
+	int    eof    = 0;
+	while (status == VECTOR_OK && (!eof || cbData))
+	{
+		if (!eof)
+		{
+			const size_t cbRead = fread(pBuffer + cbData, 1, VECTOR_TEXT_CHUNK - cbData, pFile);
+			if (ferror(pFile))
+			{
+				status = VECTOR_E_IO;
+				break;
+			}
+
+			cbData += cbRead;
+			eof     = feof(pFile);
+		}
+
+		pBuffer[cbData] = '\0';
+
+		// Only whole lines are parsed, the tail waits for the next chunk
+		const char* cpEnd = pBuffer + cbData;
+		if (!eof)
+		{
+			while (cpEnd != pBuffer && cpEnd[-1] != '\n')
+				--cpEnd;
+
+			if (cpEnd == pBuffer)
+			{
+				if (cbData == VECTOR_TEXT_CHUNK)
+					status = VECTOR_E_BAD_FORMAT;
+
+				continue;
+			}
+		}
+
+		for (const char* cpLine = pBuffer; cpLine < cpEnd && status == VECTOR_OK; )
+		{
+			status = ParseLine(cpLine, pBatch, &locale);
+
+			const char* cpNext = (const char*)memchr(cpLine, '\n', (size_t)(cpEnd - cpLine));
+			cpLine = cpNext ? cpNext + 1 : cpEnd;
+		}
+
+		cbData -= (size_t)(cpEnd - pBuffer);
+		memmove(pBuffer, cpEnd, cbData);
+	}
+
+	if (pFile)
+		fclose(pFile);
+
+	if (entered)
+		LeaveCLocale(&locale);
+
+	free(pBuffer);
+
+	if (pStatus)
+		*pStatus = status;
+
+	if (status != VECTOR_OK)
+	{
+		DeleteVectorBatch(pBatch);
+
+		return NULL;
+	}
+
+	return pBatch;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+///====================================================================================================================================
+/// File:				VectorText.h
+/// Author:				MyLibh
+/// Created:			17.10.2026
+///
+/// Last modified by:	MyLibh
+/// Last modified on:	17.10.2026
+///====================================================================================================================================
+/// Copyright(c) MyLibh. All rights reserved.
+///====================================================================================================================================
+
+#ifndef __VECTORTEXT_H_INCLUDED__
+#define __VECTORTEXT_H_INCLUDED__
+
+#include "VectorBatch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+///====================================================================================================================================
+/// <summary>   Size of the chunks the text is written and read by, one system call per chunk. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+#define VECTOR_TEXT_CHUNK (1024 * 1024)
+
+///====================================================================================================================================
+/// <summary>   Writes batch as text, one vector per line. </summary>
+///
+/// <remarks>
+/// 	MyLibh, 17.10.2026. A line is "x,y", or "re x,im x,re y,im y" for VECTOR_COMPLEX. Floating-point values are written with
+/// 	enough digits to be read back exactly. The decimal point is '.' whatever the locale is.
+/// </remarks>
+///
+/// <param name="cpPath">	Path to the file. </param>
+/// <param name="cpBatch">	Batch. </param>
+///
+/// <returns>	VECTOR_OK or error code. </returns>
+///====================================================================================================================================
+int ExportVectorText(const char* cpPath, const PVECTOR_BATCH cpBatch);
+
+///====================================================================================================================================
+/// <summary>   Reads batch written by ExportVectorText. </summary>
+///
+/// <remarks>
+/// 	MyLibh, 17.10.2026. Values may be separated by commas and/or blanks, empty lines are skipped. The decimal point is '.'
+/// 	whatever the locale is.
+/// </remarks>
+///
+/// <param name="cpPath">	Path to the file. </param>
+/// <param name="type">		Type of vector components. </param>
+/// <param name="pStatus">	VECTOR_OK or error code, may be NULL. </param>
+///
+/// <returns>	New batch or NULL. </returns>
+///====================================================================================================================================
+PVECTOR_BATCH ImportVectorText(const char* cpPath, int type, int* pStatus);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __VECTORTEXT_H_INCLUDED__ */
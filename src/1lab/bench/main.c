@@ -0,0 +1,327 @@
+// This is a personal academic project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+///====================================================================================================================================
+/// Throughput benchmark of the Vector library.
+///
+/// Prints ns/op, ops/s and heap allocations/op for create/delete, Sum and ScalarProduct of single vectors and for batches
+/// from L1- to RAM-sized. Allocations are taken from VectorStats, so the library has to be built with VECTOR_ENABLE_STATS.
+///
+/// Usage: 1lab_bench [--quick]
+///====================================================================================================================================
+
+#include "../Vector.h"
+#include "../VectorArena.h"
+#include "../VectorBatch.h"
+#include "../VectorKernels.h"
+#include "../VectorParallel.h"
+#include "../VectorStats.h"
+
+/// [url] https://en.cppreference.com/w/cpp/header/cstdio [/url]
+#include <stdio.h>
+/// [url] https://en.cppreference.com/w/cpp/header/cstdlib [/url]
+#include <stdlib.h>
+/// [url] https://en.cppreference.com/w/cpp/header/cstring [/url]
+#include <string.h>
+
+#ifdef _WIN32
+/// [url] https://docs.microsoft.com/en-us/windows/win32/api/profileapi/nf-profileapi-queryperformancecounter [/url]
+#include <windows.h>
+#else
+/// [url] https://pubs.opengroup.org/onlinepubs/9699919799/functions/clock_gettime.html [/url]
+#include <time.h>
+#endif /* _WIN32 */
+
+#define BENCH_SINGLE_OPS (1u << 20)
+
+static const char* SCP_TYPE_NAMES[VECTOR_TYPE_COUNT] = { "INT", "REAL", "COMPLEX", "FLOAT", "DOUBLE" };
+
+static double s_minSeconds = 0.25;
+
+// Results of the measured code are stored here, so the compiler can't drop it
+static volatile REAL s_sink;
+
+///====================================================================================================================================
+/// <summary>   Benchmark case, runs ops operations per call. </summary>
+///
+/// <remarks>	MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+typedef void (*PFN_BENCH_CASE)(void* pContext, size_t ops);
+
+typedef struct _BenchContext
+{
+	int                 type;
+	PVECTOR             pLHV;
+	PVECTOR             pRHV;
+	PVECTOR             pDst;
+	PVECTOR_ARENA       pArena;
+	PVECTOR_BATCH       pLHB;
+	PVECTOR_BATCH       pRHB;
+	PVECTOR_THREAD_POOL pPool;
+} BENCH_CONTEXT;
+
+// Monotonic, so that adjustments of the wall clock don't end up in the timings
+static double GetSeconds(void)
+{
+#ifdef _WIN32
+	LARGE_INTEGER now, frequency;
+	QueryPerformanceCounter(&now);
+	QueryPerformanceFrequency(&frequency);
+
+	return (double)now.QuadPart / (double)frequency.QuadPart;
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+#endif /* _WIN32 */
+}
+
+///====================================================================================================================================
+/// <summary>   Repeats the case until it takes s_minSeconds and prints the row. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///
+/// <param name="cpName">	Name of the case. </param>
+/// <param name="type">		Component type. </param>
+/// <param name="cpSize">	Working set description. </param>
+/// <param name="pfnCase">	Case. </param>
+/// <param name="pContext">	Context of the case. </param>
+/// <param name="opsPerRun">Operations per call of the case. </param>
+///====================================================================================================================================
+static void Run(const char* cpName, int type, const char* cpSize, PFN_BENCH_CASE pfnCase, void* pContext, size_t opsPerRun)
+{
+	// Warm-up brings the data into the caches and the pages into memory
+	pfnCase(pContext, opsPerRun);
+
+	VECTOR_STATS before, after;
+	GetVectorStats(&before);
+
+	size_t       runs  = 0;
+	const double start = GetSeconds();
+	double       elapsed;
+	do
+	{
+		pfnCase(pContext, opsPerRun);
+		++runs;
+		elapsed = GetSeconds() - start;
+	} while (elapsed < s_minSeconds);
+
+	GetVectorStats(&after);
+
+	const double ops = (double)runs * (double)opsPerRun;
+	printf("%-22s %-8s %-10s %12.2f ns/op %14.0f ops/s", cpName, SCP_TYPE_NAMES[type], cpSize, elapsed * 1e9 / ops, ops / elapsed);
+
+#ifdef VECTOR_ENABLE_STATS
+	// Batch cases allocate once per call of thousands of operations, which would round to 0.000
+	const double allocs = (double)(after.allocations - before.allocations) / ops;
+	if (allocs == 0 || allocs >= 0.001)
+		printf(" %8.3f allocs/op\n", allocs);
+	else
+		printf(" %8.1e allocs/op\n", allocs);
+#else
+	(void)after;
+	printf(" %8s allocs/op\n", "n/a");
+#endif /* VECTOR_ENABLE_STATS */
+}
+
+static void CreateDeleteCase(void* pContext, size_t ops)
+{
+	BENCH_CONTEXT* pCtx = (BENCH_CONTEXT*)pContext;
+	for (size_t i = 0; i < ops; ++i)
+		DeleteVector(CreateVector(pCtx->type, pCtx->pLHV->pX, pCtx->pLHV->pY));
+}
+
+static void CreateInArenaCase(void* pContext, size_t ops)
+{
+	BENCH_CONTEXT* pCtx = (BENCH_CONTEXT*)pContext;
+	for (size_t i = 0; i < ops; ++i)
+	{
+		if (!CreateVectorIn(pCtx->pArena, pCtx->type, pCtx->pLHV->pX, pCtx->pLHV->pY))
+			abort();
+	}
+
+	ResetVectorArena(pCtx->pArena);
+}
+
+static void SumCase(void* pContext, size_t ops)
+{
+	BENCH_CONTEXT* pCtx = (BENCH_CONTEXT*)pContext;
+	for (size_t i = 0; i < ops; ++i)
+		DeleteVector(Sum(pCtx->pLHV, pCtx->pRHV));
+}
+
+static void SumIntoCase(void* pContext, size_t ops)
+{
+	BENCH_CONTEXT* pCtx = (BENCH_CONTEXT*)pContext;
+	for (size_t i = 0; i < ops; ++i)
+		SumInto(pCtx->pDst, pCtx->pLHV, pCtx->pRHV);
+}
+
+static void ScalarProductCase(void* pContext, size_t ops)
+{
+	BENCH_CONTEXT* pCtx = (BENCH_CONTEXT*)pContext;
+
+	REAL sum = 0;
+	for (size_t i = 0; i < ops; ++i)
+		sum += ScalarProduct(pCtx->pLHV, pCtx->pRHV);
+
+	s_sink = sum;
+}
+
+static void BatchSumCase(void* pContext, size_t ops)
+{
+	BENCH_CONTEXT* pCtx = (BENCH_CONTEXT*)pContext;
+	(void)ops;
+
+	DeleteVectorBatch(BatchSum(pCtx->pLHB, pCtx->pRHB));
+}
+
+static void BatchDotProductCase(void* pContext, size_t ops)
+{
+	BENCH_CONTEXT* pCtx = (BENCH_CONTEXT*)pContext;
+	(void)ops;
+
+	REAL result = 0;
+	if (BatchDotProduct(pCtx->pLHB, pCtx->pRHB, &result) != VECTOR_OK)
+		abort();
+
+	s_sink = result;
+}
+
+static void ParallelDotProductCase(void* pContext, size_t ops)
+{
+	BENCH_CONTEXT* pCtx = (BENCH_CONTEXT*)pContext;
+	(void)ops;
+
+	REAL result = 0;
+	if (ParallelDotProduct(pCtx->pPool, pCtx->pLHB, pCtx->pRHB, &result) != VECTOR_OK)
+		abort();
+
+	s_sink = result;
+}
+
+///====================================================================================================================================
+/// <summary>   Fills the i-th pair of components with small values of the type. </summary>
+///
+/// <remarks>   MyLibh, 17.10.2026. </remarks>
+///====================================================================================================================================
+static void MakeComponents(int type, size_t i, void* pX, void* pY)
+{
+	const int x = (int)(i % 1000) - 500, y = (int)(i % 777) + 1;
+	switch (type)
+	{
+	case VECTOR_INTEGRAL:
+		*(INT*)pX = x;
+		*(INT*)pY = y;
+		break;
+
+	case VECTOR_REAL:
+		*(REAL*)pX = x * 0.5L;
+		*(REAL*)pY = y * 0.25L;
+		break;
+
+	case VECTOR_COMPLEX:
+		*(COMPLEX*)pX = _LCOMPLEX_(x * 0.5L, y);
+		*(COMPLEX*)pY = _LCOMPLEX_(y * 0.25L, -x);
+		break;
+
+	case VECTOR_FLOAT:
+		*(FLOAT*)pX = x * 0.5f;
+		*(FLOAT*)pY = y * 0.25f;
+		break;
+
+	case VECTOR_DOUBLE:
+		*(DOUBLE*)pX = x * 0.5;
+		*(DOUBLE*)pY = y * 0.25;
+		break;
+
+	default:
+		break;
+	}
+}
+
+static void BenchSingle(int type)
+{
+	COMPLEX x, y;
+	MakeComponents(type, 1, &x, &y);
+
+	BENCH_CONTEXT ctx;
+	memset(&ctx, 0, sizeof(ctx));
+	ctx.type   = type;
+	ctx.pLHV   = CreateVector(type, &x, &y);
+	ctx.pRHV   = CreateVector(type, &y, &x);
+	ctx.pDst   = CreateVector(type, &x, &y);
+	ctx.pArena = CreateVectorArena(0);
+	if (!ctx.pLHV || !ctx.pRHV || !ctx.pDst || !ctx.pArena)
+		abort();
+
+	Run("create/delete", type, "single", CreateDeleteCase, &ctx, BENCH_SINGLE_OPS);
+	Run("create in arena", type, "single", CreateInArenaCase, &ctx, BENCH_SINGLE_OPS);
+	Run("Sum", type, "single", SumCase, &ctx, BENCH_SINGLE_OPS);
+	Run("SumInto", type, "single", SumIntoCase, &ctx, BENCH_SINGLE_OPS);
+	Run("ScalarProduct", type, "single", ScalarProductCase, &ctx, BENCH_SINGLE_OPS);
+
+	DeleteVectorArena(ctx.pArena);
+	DeleteVector(ctx.pDst);
+	DeleteVector(ctx.pRHV);
+	DeleteVector(ctx.pLHV);
+}
+
+static void BenchBatch(int type, size_t cbWorkingSet, const char* cpSize, PVECTOR_THREAD_POOL pPool)
+{
+	// Two input batches with two components per vector make up the working set
+	const size_t count = cbWorkingSet / (4 * GetComponentSize(type));
+
+	BENCH_CONTEXT ctx;
+	memset(&ctx, 0, sizeof(ctx));
+	ctx.type  = type;
+	ctx.pLHB  = CreateVectorBatch(type, count);
+	ctx.pRHB  = CreateVectorBatch(type, count);
+	ctx.pPool = pPool;
+	if (!ctx.pLHB || !ctx.pRHB)
+		abort();
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		COMPLEX x, y;
+		MakeComponents(type, i, &x, &y);
+		PushBackComponents(ctx.pLHB, &x, &y);
+		PushBackComponents(ctx.pRHB, &y, &x);
+	}
+
+	Run("BatchSum", type, cpSize, BatchSumCase, &ctx, count);
+	Run("BatchDotProduct", type, cpSize, BatchDotProductCase, &ctx, count);
+	Run("ParallelDotProduct", type, cpSize, ParallelDotProductCase, &ctx, count);
+
+	DeleteVectorBatch(ctx.pRHB);
+	DeleteVectorBatch(ctx.pLHB);
+}
+
+int main(int argc, char* argv[])
+{
+	const int quick = argc > 1 && !strcmp(argv[1], "--quick");
+	if (quick)
+		s_minSeconds = 0.02;
+
+	static const size_t SC_WORKING_SETS[] = { 16 * 1024, 256 * 1024, 8 * 1024 * 1024, 512 * 1024 * 1024 };
+	static const char*  SCP_SIZE_NAMES[]  = { "L1", "L2", "L3", "RAM" };
+
+	const size_t nWorkingSets = quick ? 3 : sizeof(SC_WORKING_SETS) / sizeof(SC_WORKING_SETS[0]);
+
+	PVECTOR_THREAD_POOL pPool = CreateVectorThreadPool(0);
+
+	static const char* SCP_ISA_NAMES[] = { "scalar", "SSE2", "AVX2", "AVX-512" };
+	printf("kernels: %s, threads: %zu\n\n", SCP_ISA_NAMES[GetVectorKernels()->isa], GetThreadPoolSize(pPool));
+
+	for (int type = VECTOR_INTEGRAL; type <= VECTOR_COMPLEX; ++type)
+		BenchSingle(type);
+
+	for (int type = 0; type < VECTOR_TYPE_COUNT; ++type)
+		for (size_t i = 0; i < nWorkingSets; ++i)
+			BenchBatch(type, SC_WORKING_SETS[i], SCP_SIZE_NAMES[i], pPool);
+
+	DeleteVectorThreadPool(pPool);
+
+	return 0;
+}
@@ -0,0 +1,47 @@
+// This is a personal academic project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+#include "vector_tests.hpp"
+
+#include <cstring>
+
+///====================================================================================================================================
+/// Behavior checks of the Vector library.
+///
+/// Usage: 1lab_tests [name], runs every test without a name. Exit code is 0 if all checks passed.
+///====================================================================================================================================
+
+int main(int argc, char* argv[])
+{
+	static const struct
+	{
+		const char* cpName;
+		void (*pfnTest)();
+	} SC_TESTS[] =
+	{
+		{ "kernels",  vector_tests::kernels  },
+		{ "batch",    vector_tests::batch    },
+		{ "parallel", vector_tests::parallel },
+		{ "file",     vector_tests::file     },
+		{ "stats",    vector_tests::stats    }
+	};
+
+	int ran{};
+	for (auto const& crTest : SC_TESTS)
+		if (argc < 2 || !std::strcmp(argv[1], crTest.cpName))
+		{
+			const int failures{ g_failures };
+			crTest.pfnTest();
+			std::printf("%-10s %s\n", crTest.cpName, g_failures == failures ? "passed" : "FAILED");
+			++ran;
+		}
+
+	if (!ran)
+	{
+		std::fprintf(stderr, "Unknown test %s.\n", argv[1]);
+
+		return 2;
+	}
+
+	return (g_failures ? 1 : 0);
+}
@@ -0,0 +1,288 @@
+#pragma once
+
+///====================================================================================================================================
+/// File:				vector_tests.hpp
+/// Author:				MyLibh
+/// Created:			17.10.2026
+///
+/// Last modified by:	MyLibh
+/// Last modified on:	17.10.2026
+///====================================================================================================================================
+/// Copyright(c) MyLibh. All rights reserved.
+///====================================================================================================================================
+
+#ifndef __VECTOR_TESTS_HPP_INCLUDED__
+#define __VECTOR_TESTS_HPP_INCLUDED__
+
+#include "../Vector.h"
+#include "../VectorArena.h"
+#include "../VectorBatch.h"
+#include "../VectorFile.h"
+#include "../VectorKernels.h"
+#include "../VectorParallel.h"
+#include "../VectorStats.h"
+#include "../VectorText.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+inline int g_failures{};
+
+inline void check_failed(const char* cpExpr, const char* cpFile, int line)
+{
+	std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", cpFile, line, cpExpr);
+	++g_failures;
+}
+
+#define CHECK(expr) ((expr) ? (void)0 : check_failed(#expr, __FILE__, __LINE__))
+
+namespace vector_tests
+{
+	// Sizes around every vector width, so that the SIMD bodies and the scalar tails are both covered
+	inline const std::size_t SC_SIZES[] = { 0, 1, 3, 4, 7, 8, 15, 16, 17, 31, 32, 33, 63, 64, 65, 1000, 4099 };
+
+	template<typename T>
+	std::vector<T> random_components(std::size_t count, std::mt19937& rRng)
+	{
+		std::vector<T> ret_val(count);
+		for (auto& rVal : ret_val)
+			if constexpr (std::is_integral_v<T>)
+				rVal = static_cast<T>(rRng());
+			else
+				rVal = static_cast<T>(std::uniform_real_distribution<double>(-100, 100)(rRng));
+
+		return ret_val;
+	}
+
+	// Element-wise sums have to match a plain loop bit for bit, integers wrap around
+	template<typename T>
+	void kernel_add(int type)
+	{
+		std::mt19937 rng(type);
+		for (std::size_t size : SC_SIZES)
+		{
+			const auto lhs{ random_components<T>(size, rng) };
+			const auto rhs{ random_components<T>(size, rng) };
+
+			std::vector<T> sum(size);
+			GetVectorKernels()->pfnAdd[type](sum.data(), lhs.data(), rhs.data(), size);
+
+			bool equal{ true };
+			for (std::size_t i{}; i < size; ++i)
+				if constexpr (std::is_integral_v<T>)
+					equal &= (sum[i] == static_cast<T>(static_cast<unsigned>(lhs[i]) + static_cast<unsigned>(rhs[i])));
+				else
+					equal &= (sum[i] == static_cast<T>(lhs[i] + rhs[i]));
+
+			CHECK(equal);
+		}
+	}
+
+	// Integer dot products are exact, floating point ones may be summed lane by lane and are compared with a tolerance
+	template<typename T>
+	void kernel_dot_product(int type)
+	{
+		std::mt19937 rng(type + 100);
+		for (std::size_t size : SC_SIZES)
+		{
+			const auto lx{ random_components<T>(size, rng) }, ly{ random_components<T>(size, rng) };
+			const auto rx{ random_components<T>(size, rng) }, ry{ random_components<T>(size, rng) };
+
+			const REAL dot{ GetVectorKernels()->pfnDotProduct[type](lx.data(), ly.data(), rx.data(), ry.data(), size) };
+			if constexpr (std::is_integral_v<T>)
+			{
+				unsigned long long expected{};
+				for (std::size_t i{}; i < size; ++i)
+					expected += static_cast<unsigned long long>(static_cast<long long>(lx[i]) * rx[i]) +
+					            static_cast<unsigned long long>(static_cast<long long>(ly[i]) * ry[i]);
+
+				CHECK(dot == static_cast<REAL>(static_cast<long long>(expected)));
+			}
+			else
+			{
+				REAL expected{}, scale{};
+				for (std::size_t i{}; i < size; ++i)
+				{
+					const REAL products[] = { static_cast<REAL>(lx[i]) * rx[i], static_cast<REAL>(ly[i]) * ry[i] };
+					expected += products[0] + products[1];
+					scale    += std::fabs(products[0]) + std::fabs(products[1]);
+				}
+
+				CHECK(std::fabs(dot - expected) <= (scale + 1) * (size + 1) * std::numeric_limits<T>::epsilon());
+			}
+		}
+	}
+
+	inline void kernels()
+	{
+		kernel_add<INT>(VECTOR_INTEGRAL);
+		kernel_add<REAL>(VECTOR_REAL);
+		kernel_add<FLOAT>(VECTOR_FLOAT);
+		kernel_add<DOUBLE>(VECTOR_DOUBLE);
+
+		kernel_dot_product<INT>(VECTOR_INTEGRAL);
+		kernel_dot_product<REAL>(VECTOR_REAL);
+		kernel_dot_product<FLOAT>(VECTOR_FLOAT);
+		kernel_dot_product<DOUBLE>(VECTOR_DOUBLE);
+	}
+
+	[[nodiscard]]
+	inline PVECTOR_BATCH make_int_batch(std::size_t size, int seed)
+	{
+		PVECTOR_BATCH pBatch{ CreateVectorBatch(VECTOR_INTEGRAL, 0) };
+		for (std::size_t i{}; pBatch && i < size; ++i)
+		{
+			const INT x{ static_cast<INT>(i) * seed }, y{ static_cast<INT>(i) - seed };
+			CHECK(PushBackComponents(pBatch, &x, &y) == VECTOR_OK);
+		}
+
+		return pBatch;
+	}
+
+	inline void batch()
+	{
+		PVECTOR_BATCH pLHB{ make_int_batch(100, 3) }, pRHB{ make_int_batch(100, 5) };
+		CHECK(pLHB && pRHB && pLHB->size == 100);
+
+		PVECTOR_BATCH pSum{ BatchSum(pLHB, pRHB) };
+		CHECK(pSum && BATCH_X(pSum, INT, 7) == 7 * 3 + 7 * 5 && BATCH_Y(pSum, INT, 7) == (7 - 3) + (7 - 5));
+
+		std::vector<REAL> products(100);
+		CHECK(BatchScalarProduct(pLHB, pRHB, products.data()) == VECTOR_OK);
+
+		REAL expected{};
+		for (std::size_t i{}; i < 100; ++i)
+		{
+			CHECK(products[i] == static_cast<REAL>(BATCH_X(pLHB, INT, i)) * BATCH_X(pRHB, INT, i) +
+			                     static_cast<REAL>(BATCH_Y(pLHB, INT, i)) * BATCH_Y(pRHB, INT, i));
+			expected += products[i];
+		}
+
+		REAL dot{};
+		CHECK(BatchDotProduct(pLHB, pRHB, &dot) == VECTOR_OK && dot == expected);
+		CHECK(BatchDotProduct(pLHB, pSum, nullptr) == VECTOR_E_INVALID_ARG);
+
+		PVECTOR pVector{ GetBatchVector(pLHB, 10) };
+		CHECK(pVector && VEC_X(pVector, INT) == 30 && VEC_Y(pVector, INT) == 7);
+		CHECK(PushBackVector(pRHB, pVector) == VECTOR_OK && pRHB->size == 101);
+		CHECK(BatchDotProduct(pLHB, pRHB, &dot) == VECTOR_E_TYPE_MISMATCH && BatchScalarProduct(pLHB, pRHB, products.data()) == VECTOR_E_TYPE_MISMATCH);
+
+		DeleteVector(pVector);
+		DeleteVectorBatch(pSum);
+		DeleteVectorBatch(pLHB);
+		DeleteVectorBatch(pRHB);
+	}
+
+	inline void parallel()
+	{
+		PVECTOR_BATCH pLHB{ make_int_batch(3 * VECTOR_PARALLEL_CHUNK + 17, 7) }, pRHB{ make_int_batch(3 * VECTOR_PARALLEL_CHUNK + 17, 11) };
+		PVECTOR_THREAD_POOL pPool{ CreateVectorThreadPool(4) };
+		CHECK(pLHB && pRHB && pPool);
+
+		REAL dot{};
+		CHECK(ParallelDotProduct(pPool, pLHB, pRHB, &dot) == VECTOR_OK);
+		REAL expected{};
+		CHECK(BatchDotProduct(pLHB, pRHB, &expected) == VECTOR_OK && dot == expected);
+
+		INT x{}, y{};
+		CHECK(ParallelBatchTotal(pPool, pLHB, &x, &y) == VECTOR_OK);
+
+		unsigned expectedX{}, expectedY{};
+		for (std::size_t i{}; i < pLHB->size; ++i)
+		{
+			expectedX += static_cast<unsigned>(BATCH_X(pLHB, INT, i));
+			expectedY += static_cast<unsigned>(BATCH_Y(pLHB, INT, i));
+		}
+
+		CHECK(static_cast<unsigned>(x) == expectedX && static_cast<unsigned>(y) == expectedY);
+
+		DeleteVectorThreadPool(pPool);
+		DeleteVectorBatch(pLHB);
+		DeleteVectorBatch(pRHB);
+	}
+
+	// Files are written to the working directory, ctest runs the tests in the build tree
+	inline void file()
+	{
+		PVECTOR_BATCH pBatch{ CreateVectorBatch(VECTOR_DOUBLE, 0) };
+		std::mt19937  rng(5);
+		for (std::size_t i{}; i < 1000; ++i)
+		{
+			const DOUBLE x{ std::uniform_real_distribution<double>(-1e6, 1e6)(rng) }, y{ 1 / (x + 0.5) };
+			CHECK(PushBackComponents(pBatch, &x, &y) == VECTOR_OK);
+		}
+
+		const char* cpBinary{ "vector_tests.vecb" };
+		CHECK(WriteVectorFile(cpBinary, pBatch) == VECTOR_OK);
+
+		VECTOR_STATS before;
+		GetVectorStats(&before);
+
+		int           status{ -1 };
+		PVECTOR_BATCH pMapped{ MapVectorFile(cpBinary, &status) };
+		CHECK(status == VECTOR_OK && pMapped && pMapped->size == pBatch->size && pMapped->type == VECTOR_DOUBLE);
+
+		// Only the small records of a mapped batch are heap, the view isn't counted
+		VECTOR_STATS mapped;
+		GetVectorStats(&mapped);
+		CHECK(mapped.liveObjects == before.liveObjects + 2 && mapped.liveBytes - before.liveBytes < 1000);
+		if (pMapped)
+			CHECK(!std::memcmp(pMapped->pX, pBatch->pX, pBatch->size * sizeof(DOUBLE)) &&
+			      !std::memcmp(pMapped->pY, pBatch->pY, pBatch->size * sizeof(DOUBLE)));
+
+		const char* cpText{ "vector_tests.txt" };
+		CHECK(ExportVectorText(cpText, pBatch) == VECTOR_OK);
+
+		PVECTOR_BATCH pRead{ ImportVectorText(cpText, VECTOR_DOUBLE, &status) };
+		CHECK(status == VECTOR_OK && pRead && pRead->size == pBatch->size);
+		if (pRead)
+			CHECK(!std::memcmp(pRead->pX, pBatch->pX, pBatch->size * sizeof(DOUBLE)) &&
+			      !std::memcmp(pRead->pY, pBatch->pY, pBatch->size * sizeof(DOUBLE)));
+
+		DeleteVectorBatch(pRead);
+		DeleteVectorBatch(pMapped);
+		DeleteVectorBatch(pBatch);
+		std::remove(cpBinary);
+		std::remove(cpText);
+	}
+
+	// Every allocation made by a test is freed by it, the counters have to come back
+	inline void stats()
+	{
+		VECTOR_STATS before;
+		GetVectorStats(&before);
+
+		const INT     x{ 1 }, y{ 2 };
+		PVECTOR       pVector{ CreateVector(VECTOR_INTEGRAL, &x, &y) };
+		PVECTOR_BATCH pBatch{ make_int_batch(1000, 1) };
+		PVECTOR_ARENA pArena{ CreateVectorArena(0) };
+		CHECK(pVector && pBatch && pArena && CreateVectorIn(pArena, VECTOR_INTEGRAL, &x, &y));
+
+		VECTOR_STATS during;
+		GetVectorStats(&during);
+		CHECK(during.liveObjects > before.liveObjects && during.allocations > before.allocations);
+
+		DeleteVectorArena(pArena);
+		DeleteVectorBatch(pBatch);
+		DeleteVector(pVector);
+
+		VECTOR_STATS after;
+		GetVectorStats(&after);
+		CHECK(after.liveObjects == before.liveObjects && after.liveBytes == before.liveBytes);
+
+		// A reset leaves the counters alone and counts from their current values
+		ResetVectorStats();
+		DeleteVector(CreateVector(VECTOR_INTEGRAL, &x, &y));
+
+		VECTOR_STATS reset;
+		GetVectorStats(&reset);
+		CHECK(reset.allocations == 1 && reset.frees == 1 && reset.liveObjects == 0 && reset.operations[VECTOR_OP_ADD][VECTOR_INTEGRAL] == 0);
+	}
+} // namespace vector_tests
+
+#endif /* __VECTOR_TESTS_HPP_INCLUDED__ */
@@ -0,0 +1,131 @@
+#pragma once
+
+#ifndef __ARENA_HPP_INCLUDED__
+#define __ARENA_HPP_INCLUDED__
+
+#ifndef __cplusplus
+#error
+#error Must use C++ to compile.
+#error
+#endif /* __cplusplus */
+
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+inline constexpr std::size_t ARENA_BLOCK_SIZE = 1 << 16;
+
+// Append-only storage for characters. Strings are copied into large blocks and handed out as string_views,
+// which stay valid until the arena is cleared or destroyed: blocks are never moved or reallocated.
+class StringArena
+{
+public:
+	explicit StringArena(std::size_t block_size = ARENA_BLOCK_SIZE) noexcept;
+	StringArena(StringArena const&) = delete;
+	StringArena(StringArena&&) noexcept = default;
+
+	StringArena& operator=(StringArena const&) = delete;
+	StringArena& operator=(StringArena&&) noexcept = default;
+
+	// Copies str into the arena
+	[[nodiscard]]
+	std::string_view store(std::string_view str);
+
+	// Same as store, but equal strings interned before share one copy
+	[[nodiscard]]
+	std::string_view intern(std::string_view str);
+
+	// Bytes handed out so far
+	[[nodiscard]]
+	inline std::size_t size() const noexcept;
+
+	// Invalidates every view the arena has handed out
+	void clear() noexcept;
+
+private:
+	[[nodiscard]]
+	char* allocate(std::size_t size);
+
+	std::vector<std::unique_ptr<char[]>>  m_blocks;
+	std::unordered_set<std::string_view>  m_interned;
+	char*                                 m_pCur;
+	std::size_t                           m_left;
+	std::size_t                           m_size;
+	std::size_t                           m_block_size;
+};
+
+inline StringArena::StringArena(std::size_t block_size) noexcept :
+	m_blocks(),
+	m_interned(),
+	m_pCur(nullptr),
+	m_left(0),
+	m_size(0),
+	m_block_size(block_size ? block_size : 1)
+{ }
+
+inline char* StringArena::allocate(std::size_t size)
+{
+	if (size <= m_left)
+	{
+		char* const pRet{ m_pCur };
+		m_pCur += size;
+		m_left -= size;
+
+		return pRet;
+	}
+
+	// A string taking a good part of a block gets a block of its own, the rest of the current one isn't wasted
+	if (size > m_block_size / 4)
+	{
+		m_blocks.emplace_back(new char[size]);
+
+		return m_blocks.back().get();
+	}
+
+	m_blocks.emplace_back(new char[m_block_size]);
+	m_pCur = m_blocks.back().get() + size;
+	m_left = m_block_size - size;
+
+	return m_blocks.back().get();
+}
+
+inline std::string_view StringArena::store(std::string_view str)
+{
+	if (str.empty())
+		return {};
+
+	char* const pDst{ allocate(str.size()) };
+	std::memcpy(pDst, str.data(), str.size());
+	m_size += str.size();
+
+	return { pDst, str.size() };
+}
+
+inline std::string_view StringArena::intern(std::string_view str)
+{
+	if (const auto it{ m_interned.find(str) }; it != m_interned.end())
+		return *it;
+
+	const std::string_view ret_val{ store(str) };
+	m_interned.insert(ret_val);
+
+	return ret_val;
+}
+
+inline std::size_t StringArena::size() const noexcept
+{
+	return m_size;
+}
+
+inline void StringArena::clear() noexcept
+{
+	m_interned.clear();
+	m_blocks.clear();
+	m_pCur = nullptr;
+	m_left = 0;
+	m_size = 0;
+}
+
+#endif /* __ARENA_HPP_INCLUDED__ */
@@ -0,0 +1,310 @@
+#pragma once
+
+#ifndef __ASYNC_HPP_INCLUDED__
+#define __ASYNC_HPP_INCLUDED__
+
+#ifndef __cplusplus
+#error
+#error Must use C++ to compile.
+#error
+#endif /* __cplusplus */
+
+#include "Generator.hpp"
+
+// Needs coroutines and epoll, without them the header is empty
+#if defined(STREAM_COROUTINES) && defined(__linux__)
+#define STREAM_ASYNC
+
+#include <cerrno>
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include "Pipeline.hpp"
+#include "Source.hpp"
+
+class EventLoop;
+
+// Coroutine run by an EventLoop. It starts right away and runs until its first co_await on the loop.
+class Task
+{
+public:
+	class promise_type
+	{
+	public:
+		[[nodiscard]]
+		Task get_return_object() noexcept { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+
+		[[nodiscard]]
+		std::suspend_never initial_suspend() const noexcept { return {}; }
+
+		// The loop notices the end and destroys the frame
+		[[nodiscard]]
+		std::suspend_always final_suspend() const noexcept { return {}; }
+
+		void return_void() const noexcept { }
+
+		void unhandled_exception() noexcept { m_exception = std::current_exception(); }
+
+		[[nodiscard]]
+		std::exception_ptr exception() const noexcept { return m_exception; }
+
+	private:
+		std::exception_ptr m_exception;
+	};
+
+	Task(Task const&) = delete;
+	Task(Task&& rrOther) noexcept : m_handle(std::exchange(rrOther.m_handle, nullptr)) { }
+
+	~Task() noexcept
+	{
+		if (m_handle)
+			m_handle.destroy();
+	}
+
+	Task& operator=(Task const&) = delete;
+
+	Task& operator=(Task&& rrOther) noexcept
+	{
+		Task tmp(std::move(rrOther));
+		std::swap(m_handle, tmp.m_handle);
+
+		return (*this);
+	}
+
+private:
+	friend class EventLoop;
+
+	explicit Task(std::coroutine_handle<promise_type> handle) noexcept : m_handle(handle) { }
+
+	std::coroutine_handle<promise_type> m_handle;
+};
+
+// Single threaded epoll loop resuming the tasks waiting for their descriptors.
+// I/O waits of all the tasks overlap, and each of them computes on its data as soon as the data arrives.
+class EventLoop
+{
+	// co_await loop.readable(fd) suspends the task until fd has data or is closed by the other side
+	class _Readable
+	{
+	public:
+		_Readable(EventLoop& rLoop, int fd) noexcept : m_rLoop(rLoop), m_fd(fd) { }
+
+		[[nodiscard]]
+		bool await_ready() const noexcept { return false; }
+
+		void await_suspend(std::coroutine_handle<> handle) { m_rLoop.wait_readable(m_fd, handle); }
+
+		void await_resume() const noexcept { }
+
+	private:
+		EventLoop& m_rLoop;
+		int        m_fd;
+	};
+
+public:
+	EventLoop();
+	EventLoop(EventLoop const&) = delete;
+
+	EventLoop& operator=(EventLoop const&) = delete;
+
+	~EventLoop() noexcept;
+
+	[[nodiscard]]
+	inline _Readable readable(int fd) noexcept;
+
+	// Takes the task over, it is run by run()
+	void spawn(Task task);
+
+	// Waits for the descriptors and resumes the tasks until all of them are done.
+	// The first exception of a task is rethrown once the others have been run to the end. If waiting fails, the tasks
+	// still waiting are destroyed.
+	void run();
+
+private:
+	// Descriptor added to m_epoll, it is waited for one shot at a time by a single task
+	struct _Registration
+	{
+		int                     fd;
+		std::coroutine_handle<> waiter;
+	};
+
+	// Removes the descriptors from m_epoll and destroys the tasks still waiting for them, run() leaves through it
+	class _Cleanup
+	{
+	public:
+		explicit _Cleanup(EventLoop& rLoop) noexcept : m_rLoop(rLoop) { }
+		_Cleanup(_Cleanup const&) = delete;
+
+		_Cleanup& operator=(_Cleanup const&) = delete;
+
+		~_Cleanup() noexcept;
+
+	private:
+		EventLoop& m_rLoop;
+	};
+
+	void wait_readable(int fd, std::coroutine_handle<> handle);
+
+	// Destroys the finished tasks and keeps the first of their exceptions
+	void reap();
+
+	int                        m_epoll;
+	std::vector<Task>          m_tasks;
+	std::vector<_Registration> m_registered;
+	std::exception_ptr         m_exception;
+};
+
+inline EventLoop::EventLoop() :
+	m_epoll(::epoll_create1(EPOLL_CLOEXEC)),
+	m_tasks(),
+	m_registered(),
+	m_exception()
+{
+	if (m_epoll < 0)
+		throw std::runtime_error("Can't create epoll.");
+}
+
+inline EventLoop::~EventLoop() noexcept
+{
+	m_tasks.clear();
+	::close(m_epoll);
+}
+
+inline EventLoop::_Readable EventLoop::readable(int fd) noexcept
+{
+	return _Readable(*this, fd);
+}
+
+inline void EventLoop::wait_readable(int fd, std::coroutine_handle<> handle)
+{
+	std::size_t index{};
+	while (index < m_registered.size() && m_registered[index].fd != fd)
+		++index;
+
+	const bool known{ index < m_registered.size() };
+	if (known && m_registered[index].waiter)
+		throw std::runtime_error("Can't wait for the file descriptor in two tasks.");
+
+	if (!known)
+		m_registered.push_back({ fd, nullptr });
+
+	// The index stays valid: registrations are only appended until run() ends
+	epoll_event event{};
+	event.events   = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+	event.data.u64 = index;
+	if (::epoll_ctl(m_epoll, known ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, fd, &event))
+	{
+		if (!known)
+			m_registered.pop_back();
+
+		throw std::runtime_error("Can't wait for the file descriptor.");
+	}
+
+	m_registered[index].waiter = handle;
+}
+
+inline void EventLoop::spawn(Task task)
+{
+	m_tasks.push_back(std::move(task));
+	reap();
+}
+
+inline void EventLoop::reap()
+{
+	for (auto it{ m_tasks.begin() }; it != m_tasks.end(); )
+		if (it->m_handle.done())
+		{
+			if (!m_exception)
+				m_exception = it->m_handle.promise().exception();
+
+			it = m_tasks.erase(it);
+		}
+		else
+			++it;
+}
+
+inline EventLoop::_Cleanup::~_Cleanup() noexcept
+{
+	m_rLoop.m_tasks.clear();
+
+	// Descriptors may be closed and their numbers reused after the tasks are gone
+	for (auto const& crRegistration : m_rLoop.m_registered)
+		::epoll_ctl(m_rLoop.m_epoll, EPOLL_CTL_DEL, crRegistration.fd, nullptr);
+	m_rLoop.m_registered.clear();
+}
+
+inline void EventLoop::run()
+{
+	const _Cleanup cleanup(*this);
+
+	epoll_event events[64];
+	while (!m_tasks.empty())
+	{
+		const int n{ ::epoll_wait(m_epoll, events, static_cast<int>(std::size(events)), -1) };
+		if (n < 0 && errno != EINTR)
+			throw std::runtime_error("Can't wait for the file descriptors.");
+
+		for (int i{}; i < n; ++i)
+			std::exchange(m_registered[events[i].data.u64].waiter, nullptr).resume();
+
+		reap();
+	}
+
+	if (m_exception)
+		std::rethrow_exception(std::exchange(m_exception, nullptr));
+}
+
+// Reads the tokens of fd as they arrive and calls sink for each of them. fd is switched to the non-blocking mode
+// and isn't closed.
+template<typename T, typename Sink>
+Task read_async(EventLoop& rLoop, int fd, Sink sink, std::size_t chunk_size = SOURCE_CHUNK_SIZE, char delim = ' ')
+{
+	if (const int flags{ ::fcntl(fd, F_GETFL) }; flags < 0 || ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0)
+		throw std::runtime_error("Can't make the file descriptor non-blocking.");
+
+	ChunkParser<T> parser(chunk_size, delim);
+	for (;;)
+	{
+		const auto [pBuf, size] = parser.buffer();
+		const ssize_t n{ ::read(fd, pBuf, size) };
+		if (n > 0)
+			parser.commit(static_cast<std::size_t>(n), sink);
+		else if (!n)
+		{
+			parser.commit(0, sink);
+
+			co_return;
+		}
+		else if (errno == EAGAIN || errno == EWOULDBLOCK)
+			co_await rLoop.readable(fd);
+		else if (errno != EINTR)
+			throw std::runtime_error("Can't read the file descriptor.");
+	}
+}
+
+// Pipeline over the tokens arriving on fd. A terminal operation spawns the reader on the loop and runs it,
+// the tasks already spawned there progress at the same time.
+template<typename T>
+[[nodiscard]]
+inline auto make_async_pipeline(EventLoop& rLoop, int fd, std::size_t chunk_size = SOURCE_CHUNK_SIZE, char delim = ' ')
+{
+	auto push = [&rLoop, fd, chunk_size, delim](auto&& sink)
+	{
+		rLoop.spawn(read_async<T>(rLoop, fd, [&sink](T& rVal) { sink(rVal); }, chunk_size, delim));
+		rLoop.run();
+	};
+
+	return Pipeline<T, decltype(push)>(std::move(push));
+}
+
+#endif /* STREAM_COROUTINES && __linux__ */
+
+#endif /* __ASYNC_HPP_INCLUDED__ */
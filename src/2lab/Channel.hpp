@@ -0,0 +1,537 @@
+#pragma once
+
+#ifndef __CHANNEL_HPP_INCLUDED__
+#define __CHANNEL_HPP_INCLUDED__
+
+#ifndef __cplusplus
+#error
+#error Must use C++ to compile.
+#error
+#endif /* __cplusplus */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+inline constexpr std::size_t CHANNEL_CACHE_LINE = 64;
+
+[[nodiscard]]
+inline std::size_t ring_capacity(std::size_t capacity) noexcept
+{
+	std::size_t ret_val{ 2 };
+	while (ret_val < capacity)
+		ret_val <<= 1;
+
+	return ret_val;
+}
+
+// Lock-free ring for exactly one producer and one consumer thread. Each side keeps a cached copy of the other's index
+// and only reloads it when the ring looks full (empty), so the index cache lines are rarely shared.
+template<typename T>
+class SpscRing
+{
+	using _T = T;
+
+public:
+	using value_type = T;
+
+	// Rounded up to a power of two
+	explicit SpscRing(std::size_t capacity);
+
+	[[nodiscard]]
+	inline std::size_t capacity() const noexcept;
+
+	// Moves from rVal only on success
+	[[nodiscard]]
+	bool try_push(_T& rVal);
+
+	[[nodiscard]]
+	bool try_pop(_T& rVal);
+
+	// Move as many as fit (are available), return how many did
+	[[nodiscard]]
+	std::size_t try_push_n(_T* pSrc, std::size_t count);
+
+	[[nodiscard]]
+	std::size_t try_pop_n(_T* pDst, std::size_t count);
+
+private:
+	const std::size_t     m_mask;
+	std::unique_ptr<_T[]> m_slots;
+
+	alignas(CHANNEL_CACHE_LINE) std::atomic<std::size_t> m_tail; // Written by the producer
+	std::size_t                                          m_headCache;
+
+	alignas(CHANNEL_CACHE_LINE) std::atomic<std::size_t> m_head; // Written by the consumer
+	std::size_t                                          m_tailCache;
+};
+
+template<typename T>
+inline SpscRing<T>::SpscRing(std::size_t capacity) :
+	m_mask(ring_capacity(capacity) - 1),
+	m_slots(std::make_unique<_T[]>(m_mask + 1)),
+	m_tail(0),
+	m_headCache(0),
+	m_head(0),
+	m_tailCache(0)
+{ }
+
+template<typename T>
+inline std::size_t SpscRing<T>::capacity() const noexcept
+{
+	return m_mask + 1;
+}
+
+template<typename T>
+inline bool SpscRing<T>::try_push(_T& rVal)
+{
+	return (try_push_n(&rVal, 1) == 1);
+}
+
+template<typename T>
+inline bool SpscRing<T>::try_pop(_T& rVal)
+{
+	return (try_pop_n(&rVal, 1) == 1);
+}
+
+template<typename T>
+std::size_t SpscRing<T>::try_push_n(_T* pSrc, std::size_t count)
+{
+	const std::size_t tail{ m_tail.load(std::memory_order_relaxed) };
+	if (tail - m_headCache + count > capacity())
+		m_headCache = m_head.load(std::memory_order_acquire);
+
+	const std::size_t free{ capacity() - (tail - m_headCache) };
+	if (count > free)
+		count = free;
+
+	for (std::size_t i{}; i < count; ++i)
+		m_slots[(tail + i) & m_mask] = std::move(pSrc[i]);
+
+	m_tail.store(tail + count, std::memory_order_release);
+
+	return count;
+}
+
+template<typename T>
+std::size_t SpscRing<T>::try_pop_n(_T* pDst, std::size_t count)
+{
+	const std::size_t head{ m_head.load(std::memory_order_relaxed) };
+	if (m_tailCache - head < count)
+		m_tailCache = m_tail.load(std::memory_order_acquire);
+
+	const std::size_t used{ m_tailCache - head };
+	if (count > used)
+		count = used;
+
+	for (std::size_t i{}; i < count; ++i)
+		pDst[i] = std::move(m_slots[(head + i) & m_mask]);
+
+	m_head.store(head + count, std::memory_order_release);
+
+	return count;
+}
+
+// Bounded lock-free ring for any number of producers and consumers. Every slot carries a sequence number telling
+// whether it is free for the ticket of a producer or filled for the ticket of a consumer.
+template<typename T>
+class MpmcRing
+{
+	using _T = T;
+
+	struct _Slot
+	{
+		std::atomic<std::size_t> seq;
+		_T                       val;
+	};
+
+public:
+	using value_type = T;
+
+	// Rounded up to a power of two
+	explicit MpmcRing(std::size_t capacity);
+
+	[[nodiscard]]
+	inline std::size_t capacity() const noexcept;
+
+	// Moves from rVal only on success
+	[[nodiscard]]
+	bool try_push(_T& rVal);
+
+	[[nodiscard]]
+	bool try_pop(_T& rVal);
+
+	[[nodiscard]]
+	std::size_t try_push_n(_T* pSrc, std::size_t count);
+
+	[[nodiscard]]
+	std::size_t try_pop_n(_T* pDst, std::size_t count);
+
+private:
+	const std::size_t        m_mask;
+	std::unique_ptr<_Slot[]> m_slots;
+
+	alignas(CHANNEL_CACHE_LINE) std::atomic<std::size_t> m_tail;
+	alignas(CHANNEL_CACHE_LINE) std::atomic<std::size_t> m_head;
+};
+
+template<typename T>
+inline MpmcRing<T>::MpmcRing(std::size_t capacity) :
+	m_mask(ring_capacity(capacity) - 1),
+	m_slots(std::make_unique<_Slot[]>(m_mask + 1)),
+	m_tail(0),
+	m_head(0)
+{
+	for (std::size_t i{}; i <= m_mask; ++i)
+		m_slots[i].seq.store(i, std::memory_order_relaxed);
+}
+
+template<typename T>
+inline std::size_t MpmcRing<T>::capacity() const noexcept
+{
+	return m_mask + 1;
+}
+
+template<typename T>
+bool MpmcRing<T>::try_push(_T& rVal)
+{
+	std::size_t pos{ m_tail.load(std::memory_order_relaxed) };
+	for (;;)
+	{
+		_Slot&                   slot{ m_slots[pos & m_mask] };
+		const std::size_t        seq{ slot.seq.load(std::memory_order_acquire) };
+		const std::ptrdiff_t     diff{ static_cast<std::ptrdiff_t>(seq - pos) };
+		if (!diff)
+		{
+			if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+			{
+				slot.val = std::move(rVal);
+				slot.seq.store(pos + 1, std::memory_order_release);
+
+				return true;
+			}
+		}
+		else if (diff < 0)
+			return false;
+		else
+			pos = m_tail.load(std::memory_order_relaxed);
+	}
+}
+
+template<typename T>
+bool MpmcRing<T>::try_pop(_T& rVal)
+{
+	std::size_t pos{ m_head.load(std::memory_order_relaxed) };
+	for (;;)
+	{
+		_Slot&                   slot{ m_slots[pos & m_mask] };
+		const std::size_t        seq{ slot.seq.load(std::memory_order_acquire) };
+		const std::ptrdiff_t     diff{ static_cast<std::ptrdiff_t>(seq - (pos + 1)) };
+		if (!diff)
+		{
+			if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+			{
+				rVal = std::move(slot.val);
+				slot.seq.store(pos + m_mask + 1, std::memory_order_release);
+
+				return true;
+			}
+		}
+		else if (diff < 0)
+			return false;
+		else
+			pos = m_head.load(std::memory_order_relaxed);
+	}
+}
+
+template<typename T>
+std::size_t MpmcRing<T>::try_push_n(_T* pSrc, std::size_t count)
+{
+	std::size_t pushed{};
+	while (pushed < count && try_push(pSrc[pushed]))
+		++pushed;
+
+	return pushed;
+}
+
+template<typename T>
+std::size_t MpmcRing<T>::try_pop_n(_T* pDst, std::size_t count)
+{
+	std::size_t popped{};
+	while (popped < count && try_pop(pDst[popped]))
+		++popped;
+
+	return popped;
+}
+
+// Blocking layer over a ring. A full ring blocks producers (backpressure) and an empty one blocks consumers until
+// close(); after it pushes fail and pops drain what is left. Threads spin for a short while before sleeping, and the
+// other side takes the mutex to wake them only when someone actually sleeps.
+template<typename T, typename Ring = MpmcRing<T>>
+class Channel
+{
+	using _T = T;
+	using _Ring = Ring;
+
+	static constexpr int _spin_count = 64;
+
+public:
+	using value_type = T;
+
+	explicit Channel(std::size_t capacity = 1024);
+	Channel(Channel const&) = delete;
+	Channel(Channel&&) = delete;
+
+	Channel& operator=(Channel const&) = delete;
+	Channel& operator=(Channel&&)      = delete;
+
+	[[nodiscard]]
+	inline std::size_t capacity() const noexcept;
+
+	// Never blocks, moves from rVal only on success
+	[[nodiscard]]
+	bool try_push(_T& rVal);
+
+	[[nodiscard]]
+	bool try_pop(_T& rVal);
+
+	// Blocks while the channel is full, false once it is closed
+	bool push(_T val);
+
+	// Blocks while the channel is empty, false once it is closed and drained
+	[[nodiscard]]
+	bool pop(_T& rVal);
+
+	// Blocks until all count elements are in, returns fewer only if the channel gets closed
+	std::size_t push_n(_T* pSrc, std::size_t count);
+
+	// Blocks until at least one element is available, returns 0 once the channel is closed and drained
+	[[nodiscard]]
+	std::size_t pop_n(_T* pDst, std::size_t count);
+
+	void close();
+
+	[[nodiscard]]
+	inline bool closed() const noexcept;
+
+private:
+	// Runs attempt until it succeeds or gives up; sleeps on cv in between. attempt returns 0 to retry.
+	template<typename F>
+	std::size_t wait(std::condition_variable& rCv, std::atomic<int>& rWaiters, F&& attempt);
+
+	void wake(std::condition_variable& rCv, std::atomic<int>& rWaiters);
+
+	// Pushes what fits unless the channel is closed, in which case rClosed is set and the caller has to wake the
+	// consumers: one of them may be waiting for this push to see the end
+	std::size_t push_some(_T* pSrc, std::size_t count, bool& rClosed);
+
+	_Ring                   m_ring;
+	std::atomic<bool>       m_closed;
+	std::atomic<int>        m_pushing;   // Producers between their check of m_closed and the end of their push
+	std::mutex              m_mutex;
+	std::condition_variable m_notEmpty;
+	std::condition_variable m_notFull;
+	std::atomic<int>        m_consumers; // Sleeping on m_notEmpty
+	std::atomic<int>        m_producers; // Sleeping on m_notFull
+};
+
+template<typename T, typename Ring>
+inline Channel<T, Ring>::Channel(std::size_t capacity) :
+	m_ring(capacity),
+	m_closed(false),
+	m_pushing(0),
+	m_mutex(),
+	m_notEmpty(),
+	m_notFull(),
+	m_consumers(0),
+	m_producers(0)
+{ }
+
+template<typename T, typename Ring>
+inline std::size_t Channel<T, Ring>::capacity() const noexcept
+{
+	return m_ring.capacity();
+}
+
+template<typename T, typename Ring>
+inline bool Channel<T, Ring>::closed() const noexcept
+{
+	return m_closed.load();
+}
+
+template<typename T, typename Ring>
+inline void Channel<T, Ring>::wake(std::condition_variable& rCv, std::atomic<int>& rWaiters)
+{
+	// Pairs with the fence in wait(): either the sleeper sees our change or we see the sleeper
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (!rWaiters.load(std::memory_order_relaxed))
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+	}
+	rCv.notify_all();
+}
+
+template<typename T, typename Ring>
+template<typename F>
+std::size_t Channel<T, Ring>::wait(std::condition_variable& rCv, std::atomic<int>& rWaiters, F&& attempt)
+{
+	for (int i{}; i < _spin_count; ++i)
+	{
+		if (const std::size_t ret_val{ attempt() }; ret_val)
+			return ret_val;
+
+		std::this_thread::yield();
+	}
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	for (;;)
+	{
+		rWaiters.fetch_add(1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		const std::size_t ret_val{ attempt() };
+		if (!ret_val)
+			rCv.wait(lock);
+
+		rWaiters.fetch_sub(1, std::memory_order_relaxed);
+		if (ret_val)
+			return ret_val;
+	}
+}
+
+template<typename T, typename Ring>
+std::size_t Channel<T, Ring>::push_some(_T* pSrc, std::size_t count, bool& rClosed)
+{
+	// Consumers don't report the end while a push is in flight, so an element pushed right before close() isn't lost
+	// and one pushed right after it isn't taken for delivered
+	m_pushing.fetch_add(1);
+	rClosed = closed();
+
+	std::size_t ret_val{};
+	try
+	{
+		if (!rClosed)
+			ret_val = m_ring.try_push_n(pSrc, count);
+	}
+	catch (...)
+	{
+		m_pushing.fetch_sub(1);
+
+		throw;
+	}
+
+	m_pushing.fetch_sub(1);
+
+	return ret_val;
+}
+
+template<typename T, typename Ring>
+bool Channel<T, Ring>::try_push(_T& rVal)
+{
+	bool closed_now{};
+	if (!push_some(&rVal, 1, closed_now))
+	{
+		if (closed_now)
+			wake(m_notEmpty, m_consumers);
+
+		return false;
+	}
+
+	wake(m_notEmpty, m_consumers);
+
+	return true;
+}
+
+template<typename T, typename Ring>
+bool Channel<T, Ring>::try_pop(_T& rVal)
+{
+	if (!m_ring.try_pop(rVal))
+		return false;
+
+	wake(m_notFull, m_producers);
+
+	return true;
+}
+
+template<typename T, typename Ring>
+bool Channel<T, Ring>::push(_T val)
+{
+	return (push_n(&val, 1) == 1);
+}
+
+template<typename T, typename Ring>
+bool Channel<T, Ring>::pop(_T& rVal)
+{
+	return (pop_n(&rVal, 1) == 1);
+}
+
+template<typename T, typename Ring>
+std::size_t Channel<T, Ring>::push_n(_T* pSrc, std::size_t count)
+{
+	std::size_t pushed{};
+	while (pushed < count)
+	{
+		// 1 + n so that a closed channel ends the wait with n == 0
+		const std::size_t ret_val{ wait(m_notFull, m_producers, [&]() -> std::size_t
+		{
+			bool              closed_now{};
+			const std::size_t n{ push_some(pSrc + pushed, count - pushed, closed_now) };
+
+			return (n || closed_now ? 1 + n : 0);
+		}) };
+		if (ret_val == 1)
+		{
+			wake(m_notEmpty, m_consumers);
+
+			break;
+		}
+
+		pushed += ret_val - 1;
+		wake(m_notEmpty, m_consumers);
+	}
+
+	return pushed;
+}
+
+template<typename T, typename Ring>
+std::size_t Channel<T, Ring>::pop_n(_T* pDst, std::size_t count)
+{
+	if (!count)
+		return 0;
+
+	const std::size_t ret_val{ wait(m_notEmpty, m_consumers, [&]() -> std::size_t
+	{
+		// Checked before popping so that an element pushed right before close() isn't missed
+		const bool        was_closed{ closed() };
+		const bool        in_flight{ m_pushing.load() != 0 };
+		const std::size_t n{ m_ring.try_pop_n(pDst, count) };
+
+		return (n || (was_closed && !in_flight) ? 1 + n : 0);
+	}) };
+
+	if (ret_val > 1)
+		wake(m_notFull, m_producers);
+
+	return ret_val - 1;
+}
+
+template<typename T, typename Ring>
+void Channel<T, Ring>::close()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_closed.store(true);
+	}
+
+	m_notEmpty.notify_all();
+	m_notFull.notify_all();
+}
+
+#endif /* __CHANNEL_HPP_INCLUDED__ */
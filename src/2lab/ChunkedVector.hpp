@@ -0,0 +1,657 @@
+#pragma once
+
+#ifndef __CHUNKED_VECTOR_HPP_INCLUDED__
+#define __CHUNKED_VECTOR_HPP_INCLUDED__
+
+#ifndef __cplusplus
+#error
+#error Must use C++ to compile.
+#error
+#endif /* __cplusplus */
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Sequence stored in fixed-size blocks. Growing allocates one more block and never moves the elements, so their
+// addresses are stable and the peak memory is the data plus one block. Removing from the front frees the blocks
+// as they empty. Iterators are random access but are invalidated by every change of the size.
+template<typename T, typename Alloc = std::allocator<T>>
+class ChunkedVector
+{
+	using _T = T;
+	using _Alloc_traits = std::allocator_traits<typename std::allocator_traits<Alloc>::template rebind_alloc<T>>;
+
+	// Largest power of two elements fitting in about 16 KiB
+	[[nodiscard]]
+	static constexpr std::size_t block_elements() noexcept
+	{
+		std::size_t ret_val{ 1 };
+		while (2 * ret_val * sizeof(T) <= (1 << 14))
+			ret_val *= 2;
+
+		return ret_val;
+	}
+
+	template<bool Const>
+	class _Iterator;
+
+public:
+	using value_type      = T;
+	using allocator_type  = typename _Alloc_traits::allocator_type;
+	using size_type       = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference       = T&;
+	using const_reference = T const&;
+	using pointer         = T*;
+	using const_pointer   = T const*;
+	using iterator        = _Iterator<false>;
+	using const_iterator  = _Iterator<true>;
+
+	static constexpr size_type block_size = block_elements();
+
+	ChunkedVector() noexcept(std::is_nothrow_default_constructible_v<allocator_type>) = default;
+	explicit ChunkedVector(allocator_type const& crAlloc) noexcept;
+	explicit ChunkedVector(size_type count, allocator_type const& crAlloc = allocator_type());
+	ChunkedVector(size_type count, _T const& crVal, allocator_type const& crAlloc = allocator_type());
+	ChunkedVector(std::initializer_list<_T> list, allocator_type const& crAlloc = allocator_type());
+
+	template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+	ChunkedVector(InputIt first, InputIt last, allocator_type const& crAlloc = allocator_type());
+
+	ChunkedVector(ChunkedVector const& crOther);
+	ChunkedVector(ChunkedVector&& rrOther) noexcept;
+
+	~ChunkedVector() noexcept;
+
+	ChunkedVector& operator=(ChunkedVector const& crOther);
+	ChunkedVector& operator=(ChunkedVector&& rrOther) noexcept;
+
+	[[nodiscard]]
+	inline iterator begin() noexcept;
+
+	[[nodiscard]]
+	inline const_iterator begin() const noexcept;
+
+	[[nodiscard]]
+	inline const_iterator cbegin() const noexcept;
+
+	[[nodiscard]]
+	inline iterator end() noexcept;
+
+	[[nodiscard]]
+	inline const_iterator end() const noexcept;
+
+	[[nodiscard]]
+	inline const_iterator cend() const noexcept;
+
+	[[nodiscard]]
+	inline size_type size() const noexcept;
+
+	[[nodiscard]]
+	inline bool empty() const noexcept;
+
+	[[nodiscard]]
+	inline allocator_type get_allocator() const noexcept;
+
+	[[nodiscard]]
+	inline _T& operator[](size_type pos) noexcept;
+
+	[[nodiscard]]
+	inline _T const& operator[](size_type pos) const noexcept;
+
+	[[nodiscard]]
+	_T& at(size_type pos);
+
+	[[nodiscard]]
+	_T const& at(size_type pos) const;
+
+	[[nodiscard]]
+	inline _T& front() noexcept;
+
+	[[nodiscard]]
+	inline _T& back() noexcept;
+
+	// Calls func(first, last) for every block in order with the pointer range of its elements
+	template<typename F>
+	void for_each_segment(F&& func);
+
+	template<typename F>
+	void for_each_segment(F&& func) const;
+
+	inline void push_back(_T const& crVal);
+
+	inline void push_back(_T&& rrVal);
+
+	template<typename... Args>
+	_T& emplace_back(Args&&... args);
+
+	void pop_back() noexcept;
+
+	void pop_front() noexcept;
+
+	// Only [first, end) and prefixes are cheap, anything else moves the tail
+	iterator erase(const_iterator first, const_iterator last);
+
+	void resize(size_type count);
+
+	// Blocks are allocated in advance, their addresses don't change
+	void reserve(size_type count);
+
+	// Frees the blocks past the last element
+	void shrink_to_fit() noexcept;
+
+	void clear() noexcept;
+
+	void swap(ChunkedVector& rOther) noexcept;
+
+private:
+	[[nodiscard]]
+	inline _T* slot(size_type pos) const noexcept;
+
+	[[nodiscard]]
+	inline size_type block_count() const noexcept;
+
+	void add_block();
+
+	void free_blocks(std::size_t first) noexcept;
+
+	std::vector<_T*> m_blocks;
+	size_type        m_head{};  // Blocks in front of m_blocks[m_head] are freed, their pointers are dropped as the array grows
+	size_type        m_first{}; // Position of the front element in m_blocks[m_head]
+	size_type        m_size{};
+	allocator_type   m_alloc{};
+};
+
+template<typename T, typename Alloc>
+template<bool Const>
+class ChunkedVector<T, Alloc>::_Iterator
+{
+	friend class ChunkedVector;
+
+	template<bool>
+	friend class _Iterator;
+
+	_Iterator(T* const* pBlocks, size_type pos) noexcept :
+		m_pBlocks(pBlocks),
+		m_pos(pos)
+	{ }
+
+public:
+	using iterator_category = std::random_access_iterator_tag;
+	using value_type        = T;
+	using difference_type   = std::ptrdiff_t;
+	using pointer           = std::conditional_t<Const, T const*, T*>;
+	using reference         = std::conditional_t<Const, T const&, T&>;
+
+	_Iterator() noexcept = default;
+
+	// iterator converts to const_iterator
+	template<bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+	_Iterator(_Iterator<OtherConst> const& crOther) noexcept :
+		m_pBlocks(crOther.m_pBlocks),
+		m_pos(crOther.m_pos)
+	{ }
+
+	[[nodiscard]]
+	reference operator*() const noexcept { return m_pBlocks[m_pos / block_size][m_pos % block_size]; }
+
+	[[nodiscard]]
+	pointer operator->() const noexcept { return &**this; }
+
+	[[nodiscard]]
+	reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+	_Iterator& operator++() noexcept { ++m_pos; return (*this); }
+	_Iterator& operator--() noexcept { --m_pos; return (*this); }
+	_Iterator operator++(int) noexcept { return { m_pBlocks, m_pos++ }; }
+	_Iterator operator--(int) noexcept { return { m_pBlocks, m_pos-- }; }
+
+	_Iterator& operator+=(difference_type n) noexcept { m_pos += n; return (*this); }
+	_Iterator& operator-=(difference_type n) noexcept { m_pos -= n; return (*this); }
+
+	[[nodiscard]]
+	friend _Iterator operator+(_Iterator it, difference_type n) noexcept { return (it += n); }
+
+	[[nodiscard]]
+	friend _Iterator operator+(difference_type n, _Iterator it) noexcept { return (it += n); }
+
+	[[nodiscard]]
+	friend _Iterator operator-(_Iterator it, difference_type n) noexcept { return (it -= n); }
+
+	[[nodiscard]]
+	friend difference_type operator-(_Iterator const& crLHS, _Iterator const& crRHS) noexcept
+	{
+		return static_cast<difference_type>(crLHS.m_pos) - static_cast<difference_type>(crRHS.m_pos);
+	}
+
+	[[nodiscard]]
+	friend bool operator==(_Iterator const& crLHS, _Iterator const& crRHS) noexcept { return (crLHS.m_pos == crRHS.m_pos); }
+
+	[[nodiscard]]
+	friend bool operator!=(_Iterator const& crLHS, _Iterator const& crRHS) noexcept { return (crLHS.m_pos != crRHS.m_pos); }
+
+	[[nodiscard]]
+	friend bool operator<(_Iterator const& crLHS, _Iterator const& crRHS) noexcept { return (crLHS.m_pos < crRHS.m_pos); }
+
+	[[nodiscard]]
+	friend bool operator>(_Iterator const& crLHS, _Iterator const& crRHS) noexcept { return (crLHS.m_pos > crRHS.m_pos); }
+
+	[[nodiscard]]
+	friend bool operator<=(_Iterator const& crLHS, _Iterator const& crRHS) noexcept { return (crLHS.m_pos <= crRHS.m_pos); }
+
+	[[nodiscard]]
+	friend bool operator>=(_Iterator const& crLHS, _Iterator const& crRHS) noexcept { return (crLHS.m_pos >= crRHS.m_pos); }
+
+private:
+	T* const* m_pBlocks{};
+	size_type m_pos{}; // Counted from the start of the first block
+};
+
+template<typename T, typename Alloc>
+inline ChunkedVector<T, Alloc>::ChunkedVector(allocator_type const& crAlloc) noexcept :
+	m_blocks(),
+	m_alloc(crAlloc)
+{ }
+
+template<typename T, typename Alloc>
+inline ChunkedVector<T, Alloc>::ChunkedVector(size_type count, allocator_type const& crAlloc) :
+	m_blocks(),
+	m_alloc(crAlloc)
+{
+	resize(count);
+}
+
+template<typename T, typename Alloc>
+inline ChunkedVector<T, Alloc>::ChunkedVector(size_type count, _T const& crVal, allocator_type const& crAlloc) :
+	m_blocks(),
+	m_alloc(crAlloc)
+{
+	reserve(count);
+	while (count--)
+		push_back(crVal);
+}
+
+template<typename T, typename Alloc>
+inline ChunkedVector<T, Alloc>::ChunkedVector(std::initializer_list<_T> list, allocator_type const& crAlloc) :
+	ChunkedVector(list.begin(), list.end(), crAlloc)
+{ }
+
+template<typename T, typename Alloc>
+template<typename InputIt, typename>
+inline ChunkedVector<T, Alloc>::ChunkedVector(InputIt first, InputIt last, allocator_type const& crAlloc) :
+	m_blocks(),
+	m_alloc(crAlloc)
+{
+	if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>)
+		reserve(static_cast<size_type>(std::distance(first, last)));
+
+	for (; first != last; ++first)
+		emplace_back(*first);
+}
+
+template<typename T, typename Alloc>
+inline ChunkedVector<T, Alloc>::ChunkedVector(ChunkedVector const& crOther) :
+	ChunkedVector(crOther.begin(), crOther.end(), _Alloc_traits::select_on_container_copy_construction(crOther.m_alloc))
+{ }
+
+template<typename T, typename Alloc>
+inline ChunkedVector<T, Alloc>::ChunkedVector(ChunkedVector&& rrOther) noexcept :
+	m_blocks(std::move(rrOther.m_blocks)),
+	m_head(std::exchange(rrOther.m_head, 0)),
+	m_first(std::exchange(rrOther.m_first, 0)),
+	m_size(std::exchange(rrOther.m_size, 0)),
+	m_alloc(std::move(rrOther.m_alloc))
+{
+	rrOther.m_blocks.clear();
+}
+
+template<typename T, typename Alloc>
+inline ChunkedVector<T, Alloc>::~ChunkedVector() noexcept
+{
+	clear();
+}
+
+template<typename T, typename Alloc>
+inline ChunkedVector<T, Alloc>& ChunkedVector<T, Alloc>::operator=(ChunkedVector const& crOther)
+{
+	if (this != &crOther)
+	{
+		ChunkedVector tmp(crOther);
+		swap(tmp);
+	}
+
+	return (*this);
+}
+
+template<typename T, typename Alloc>
+inline ChunkedVector<T, Alloc>& ChunkedVector<T, Alloc>::operator=(ChunkedVector&& rrOther) noexcept
+{
+	ChunkedVector tmp(std::move(rrOther));
+	swap(tmp);
+
+	return (*this);
+}
+
+template<typename T, typename Alloc>
+inline typename ChunkedVector<T, Alloc>::iterator ChunkedVector<T, Alloc>::begin() noexcept
+{
+	return { m_blocks.data() + m_head, m_first };
+}
+
+template<typename T, typename Alloc>
+inline typename ChunkedVector<T, Alloc>::const_iterator ChunkedVector<T, Alloc>::begin() const noexcept
+{
+	return { m_blocks.data() + m_head, m_first };
+}
+
+template<typename T, typename Alloc>
+inline typename ChunkedVector<T, Alloc>::const_iterator ChunkedVector<T, Alloc>::cbegin() const noexcept
+{
+	return begin();
+}
+
+template<typename T, typename Alloc>
+inline typename ChunkedVector<T, Alloc>::iterator ChunkedVector<T, Alloc>::end() noexcept
+{
+	return { m_blocks.data() + m_head, m_first + m_size };
+}
+
+template<typename T, typename Alloc>
+inline typename ChunkedVector<T, Alloc>::const_iterator ChunkedVector<T, Alloc>::end() const noexcept
+{
+	return { m_blocks.data() + m_head, m_first + m_size };
+}
+
+template<typename T, typename Alloc>
+inline typename ChunkedVector<T, Alloc>::const_iterator ChunkedVector<T, Alloc>::cend() const noexcept
+{
+	return end();
+}
+
+template<typename T, typename Alloc>
+inline typename ChunkedVector<T, Alloc>::size_type ChunkedVector<T, Alloc>::size() const noexcept
+{
+	return m_size;
+}
+
+template<typename T, typename Alloc>
+inline bool ChunkedVector<T, Alloc>::empty() const noexcept
+{
+	return !m_size;
+}
+
+template<typename T, typename Alloc>
+inline typename ChunkedVector<T, Alloc>::allocator_type ChunkedVector<T, Alloc>::get_allocator() const noexcept
+{
+	return m_alloc;
+}
+
+template<typename T, typename Alloc>
+inline T* ChunkedVector<T, Alloc>::slot(size_type pos) const noexcept
+{
+	pos += m_first;
+
+	return m_blocks[m_head + pos / block_size] + pos % block_size;
+}
+
+template<typename T, typename Alloc>
+inline typename ChunkedVector<T, Alloc>::size_type ChunkedVector<T, Alloc>::block_count() const noexcept
+{
+	return m_blocks.size() - m_head;
+}
+
+template<typename T, typename Alloc>
+inline T& ChunkedVector<T, Alloc>::operator[](size_type pos) noexcept
+{
+	return *slot(pos);
+}
+
+template<typename T, typename Alloc>
+inline T const& ChunkedVector<T, Alloc>::operator[](size_type pos) const noexcept
+{
+	return *slot(pos);
+}
+
+template<typename T, typename Alloc>
+inline T& ChunkedVector<T, Alloc>::at(size_type pos)
+{
+	if (pos >= m_size)
+		throw std::out_of_range("Wrong index.");
+
+	return *slot(pos);
+}
+
+template<typename T, typename Alloc>
+inline T const& ChunkedVector<T, Alloc>::at(size_type pos) const
+{
+	if (pos >= m_size)
+		throw std::out_of_range("Wrong index.");
+
+	return *slot(pos);
+}
+
+template<typename T, typename Alloc>
+inline T& ChunkedVector<T, Alloc>::front() noexcept
+{
+	return *slot(0);
+}
+
+template<typename T, typename Alloc>
+inline T& ChunkedVector<T, Alloc>::back() noexcept
+{
+	return *slot(m_size - 1);
+}
+
+template<typename T, typename Alloc>
+template<typename F>
+void ChunkedVector<T, Alloc>::for_each_segment(F&& func)
+{
+	for (size_type pos{ m_first }, last{ m_first + m_size }; pos < last; )
+	{
+		const size_type block_last{ std::min(last, (pos / block_size + 1) * block_size) };
+		_T* const       pFirst{ m_blocks[m_head + pos / block_size] + pos % block_size };
+
+		func(pFirst, pFirst + (block_last - pos));
+		pos = block_last;
+	}
+}
+
+template<typename T, typename Alloc>
+template<typename F>
+void ChunkedVector<T, Alloc>::for_each_segment(F&& func) const
+{
+	for (size_type pos{ m_first }, last{ m_first + m_size }; pos < last; )
+	{
+		const size_type block_last{ std::min(last, (pos / block_size + 1) * block_size) };
+		_T const* const pFirst{ m_blocks[m_head + pos / block_size] + pos % block_size };
+
+		func(pFirst, pFirst + (block_last - pos));
+		pos = block_last;
+	}
+}
+
+template<typename T, typename Alloc>
+void ChunkedVector<T, Alloc>::add_block()
+{
+	_T* const pBlock{ _Alloc_traits::allocate(m_alloc, block_size) };
+	try
+	{
+		// Dropping the freed pointers once they are at least half of a full array keeps draining and refilling linear
+		if (m_blocks.size() == m_blocks.capacity() && m_head && m_head >= block_count())
+		{
+			m_blocks.erase(m_blocks.begin(), m_blocks.begin() + static_cast<difference_type>(m_head));
+			m_head = 0;
+		}
+
+		m_blocks.push_back(pBlock);
+	}
+	catch (...)
+	{
+		_Alloc_traits::deallocate(m_alloc, pBlock, block_size);
+
+		throw;
+	}
+}
+
+template<typename T, typename Alloc>
+void ChunkedVector<T, Alloc>::free_blocks(std::size_t first) noexcept
+{
+	for (std::size_t i{ m_head + first }; i < m_blocks.size(); ++i)
+		_Alloc_traits::deallocate(m_alloc, m_blocks[i], block_size);
+
+	m_blocks.resize(m_head + first);
+}
+
+template<typename T, typename Alloc>
+inline void ChunkedVector<T, Alloc>::push_back(_T const& crVal)
+{
+	emplace_back(crVal);
+}
+
+template<typename T, typename Alloc>
+inline void ChunkedVector<T, Alloc>::push_back(_T&& rrVal)
+{
+	emplace_back(std::move(rrVal));
+}
+
+template<typename T, typename Alloc>
+template<typename... Args>
+inline T& ChunkedVector<T, Alloc>::emplace_back(Args&&... args)
+{
+	if (m_first + m_size == block_count() * block_size)
+		add_block();
+
+	_T* const pSlot{ slot(m_size) };
+	_Alloc_traits::construct(m_alloc, pSlot, std::forward<Args>(args)...);
+	++m_size;
+
+	return *pSlot;
+}
+
+template<typename T, typename Alloc>
+inline void ChunkedVector<T, Alloc>::pop_back() noexcept
+{
+	_Alloc_traits::destroy(m_alloc, slot(m_size - 1));
+	--m_size;
+}
+
+template<typename T, typename Alloc>
+inline void ChunkedVector<T, Alloc>::pop_front() noexcept
+{
+	_Alloc_traits::destroy(m_alloc, slot(0));
+	--m_size;
+
+	if (!m_size)
+		m_first = 0;
+	else if (++m_first == block_size)
+	{
+		_Alloc_traits::deallocate(m_alloc, m_blocks[m_head++], block_size);
+		m_first = 0;
+	}
+}
+
+template<typename T, typename Alloc>
+typename ChunkedVector<T, Alloc>::iterator ChunkedVector<T, Alloc>::erase(const_iterator first, const_iterator last)
+{
+	const size_type index{ first.m_pos - m_first };
+	const size_type count{ last.m_pos - first.m_pos };
+	if (!count)
+		return begin() + static_cast<difference_type>(index);
+
+	if (index == 0 && count < m_size)
+	{
+		for (size_type i{}; i < count; ++i)
+			_Alloc_traits::destroy(m_alloc, slot(i));
+
+		// The blocks in front of the new first element are freed
+		m_first += count;
+		m_size  -= count;
+
+		const size_type nFree{ m_first / block_size };
+		for (size_type i{}; i < nFree; ++i)
+			_Alloc_traits::deallocate(m_alloc, m_blocks[m_head++], block_size);
+
+		m_first %= block_size;
+
+		return begin();
+	}
+
+	std::move(begin() + static_cast<difference_type>(index + count), end(), begin() + static_cast<difference_type>(index));
+	for (size_type i{}; i < count; ++i)
+		pop_back();
+
+	if (!m_size)
+		m_first = 0;
+
+	return begin() + static_cast<difference_type>(index);
+}
+
+template<typename T, typename Alloc>
+void ChunkedVector<T, Alloc>::resize(size_type count)
+{
+	reserve(count);
+
+	while (m_size > count)
+		pop_back();
+	while (m_size < count)
+		emplace_back();
+}
+
+template<typename T, typename Alloc>
+void ChunkedVector<T, Alloc>::reserve(size_type count)
+{
+	const size_type nBlocks{ (m_first + count + block_size - 1) / block_size };
+	if (nBlocks <= block_count())
+		return;
+
+	m_blocks.erase(m_blocks.begin(), m_blocks.begin() + static_cast<difference_type>(m_head));
+	m_head = 0;
+	m_blocks.reserve(nBlocks);
+	while (m_blocks.size() < nBlocks)
+		add_block();
+}
+
+template<typename T, typename Alloc>
+inline void ChunkedVector<T, Alloc>::shrink_to_fit() noexcept
+{
+	free_blocks((m_first + m_size + block_size - 1) / block_size);
+}
+
+template<typename T, typename Alloc>
+void ChunkedVector<T, Alloc>::clear() noexcept
+{
+	while (m_size)
+		pop_back();
+
+	m_first = 0;
+	free_blocks(0);
+	m_blocks.clear();
+	m_blocks.shrink_to_fit();
+	m_head = 0;
+}
+
+template<typename T, typename Alloc>
+inline void ChunkedVector<T, Alloc>::swap(ChunkedVector& rOther) noexcept
+{
+	using std::swap; // Enable all swaps
+	swap(m_blocks, rOther.m_blocks);
+	swap(m_head, rOther.m_head);
+	swap(m_first, rOther.m_first);
+	swap(m_size, rOther.m_size);
+	swap(m_alloc, rOther.m_alloc);
+}
+
+template<typename T, typename Alloc>
+inline void swap(ChunkedVector<T, Alloc>& rLHS, ChunkedVector<T, Alloc>& rRHS) noexcept
+{
+	rLHS.swap(rRHS);
+}
+
+#endif /* __CHUNKED_VECTOR_HPP_INCLUDED__ */
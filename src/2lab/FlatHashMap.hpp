@@ -0,0 +1,276 @@
+#pragma once
+
+#ifndef __FLAT_HASH_MAP_HPP_INCLUDED__
+#define __FLAT_HASH_MAP_HPP_INCLUDED__
+
+#ifndef __cplusplus
+#error
+#error Must use C++ to compile.
+#error
+#endif /* __cplusplus */
+
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// Open addressing hash map with linear probing. The entries are kept in one array in insertion order and the table
+// holds only their indices with a part of the hash, so probing touches a few bytes per slot and iteration is a plain
+// array walk. There is no erase, which is all the aggregations need.
+template<typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class FlatHashMap
+{
+	using _K = K;
+	using _V = V;
+
+	struct _Slot
+	{
+		std::uint32_t hash;
+		std::uint32_t index; // Entry index + 1, 0 for an empty slot
+	};
+
+	// Smallest table, the load factor is kept at most 3/4
+	static constexpr std::size_t _min_slots = 16;
+
+public:
+	using key_type       = K;
+	using mapped_type    = V;
+	using value_type     = std::pair<K, V>;
+	using iterator       = typename std::vector<value_type>::iterator;
+	using const_iterator = typename std::vector<value_type>::const_iterator;
+
+	FlatHashMap() = default;
+	explicit FlatHashMap(std::size_t count, Hash hash = Hash(), KeyEqual equal = KeyEqual());
+
+	[[nodiscard]]
+	inline iterator begin() noexcept;
+
+	[[nodiscard]]
+	inline const_iterator begin() const noexcept;
+
+	[[nodiscard]]
+	inline iterator end() noexcept;
+
+	[[nodiscard]]
+	inline const_iterator end() const noexcept;
+
+	[[nodiscard]]
+	inline std::size_t size() const noexcept;
+
+	[[nodiscard]]
+	inline bool empty() const noexcept;
+
+	void reserve(std::size_t count);
+
+	void clear() noexcept;
+
+	[[nodiscard]]
+	iterator find(_K const& crKey);
+
+	[[nodiscard]]
+	const_iterator find(_K const& crKey) const;
+
+	// Throws std::out_of_range for a missing key
+	[[nodiscard]]
+	_V& at(_K const& crKey);
+
+	[[nodiscard]]
+	_V const& at(_K const& crKey) const;
+
+	// Constructs the value from args only if the key is missing
+	template<typename... Args>
+	std::pair<iterator, bool> try_emplace(_K const& crKey, Args&&... args);
+
+	_V& operator[](_K const& crKey);
+
+private:
+	[[nodiscard]]
+	inline std::uint32_t hash(_K const& crKey) const;
+
+	// Slot holding the key or the empty slot where it belongs
+	[[nodiscard]]
+	std::size_t probe(_K const& crKey, std::uint32_t hash) const;
+
+	void rehash(std::size_t nSlots);
+
+	std::vector<value_type> m_entries;
+	std::vector<_Slot>      m_slots;
+	Hash                    m_hash;
+	KeyEqual                m_equal;
+};
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+inline FlatHashMap<K, V, Hash, KeyEqual>::FlatHashMap(std::size_t count, Hash hash, KeyEqual equal) :
+	m_entries(),
+	m_slots(),
+	m_hash(std::move(hash)),
+	m_equal(std::move(equal))
+{
+	reserve(count);
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+inline typename FlatHashMap<K, V, Hash, KeyEqual>::iterator FlatHashMap<K, V, Hash, KeyEqual>::begin() noexcept
+{
+	return std::begin(m_entries);
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+inline typename FlatHashMap<K, V, Hash, KeyEqual>::const_iterator FlatHashMap<K, V, Hash, KeyEqual>::begin() const noexcept
+{
+	return std::cbegin(m_entries);
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+inline typename FlatHashMap<K, V, Hash, KeyEqual>::iterator FlatHashMap<K, V, Hash, KeyEqual>::end() noexcept
+{
+	return std::end(m_entries);
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+inline typename FlatHashMap<K, V, Hash, KeyEqual>::const_iterator FlatHashMap<K, V, Hash, KeyEqual>::end() const noexcept
+{
+	return std::cend(m_entries);
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+inline std::size_t FlatHashMap<K, V, Hash, KeyEqual>::size() const noexcept
+{
+	return std::size(m_entries);
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+inline bool FlatHashMap<K, V, Hash, KeyEqual>::empty() const noexcept
+{
+	return m_entries.empty();
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+inline std::uint32_t FlatHashMap<K, V, Hash, KeyEqual>::hash(_K const& crKey) const
+{
+	// std::hash of an integer is usually the integer itself, mixing spreads consecutive keys over the table
+	std::uint64_t h{ static_cast<std::uint64_t>(m_hash(crKey)) * 0x9E3779B97F4A7C15ULL };
+
+	return static_cast<std::uint32_t>(h >> 32);
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+std::size_t FlatHashMap<K, V, Hash, KeyEqual>::probe(_K const& crKey, std::uint32_t hash) const
+{
+	const std::size_t mask{ m_slots.size() - 1 };
+	for (std::size_t i{ hash & mask }; ; i = (i + 1) & mask)
+	{
+		const _Slot& crSlot{ m_slots[i] };
+		if (!crSlot.index || (crSlot.hash == hash && m_equal(m_entries[crSlot.index - 1].first, crKey)))
+			return i;
+	}
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+void FlatHashMap<K, V, Hash, KeyEqual>::rehash(std::size_t nSlots)
+{
+	std::vector<_Slot> slots(nSlots);
+
+	const std::size_t mask{ nSlots - 1 };
+	for (auto const& crSlot : m_slots)
+		if (crSlot.index)
+		{
+			std::size_t i{ crSlot.hash & mask };
+			while (slots[i].index)
+				i = (i + 1) & mask;
+
+			slots[i] = crSlot;
+		}
+
+	m_slots.swap(slots);
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+void FlatHashMap<K, V, Hash, KeyEqual>::reserve(std::size_t count)
+{
+	std::size_t nSlots{ _min_slots };
+	while (nSlots / 4 * 3 < count)
+		nSlots *= 2;
+
+	if (nSlots > m_slots.size())
+		rehash(nSlots);
+
+	m_entries.reserve(count);
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+inline void FlatHashMap<K, V, Hash, KeyEqual>::clear() noexcept
+{
+	m_entries.clear();
+	m_slots.assign(m_slots.size(), _Slot{});
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+typename FlatHashMap<K, V, Hash, KeyEqual>::iterator FlatHashMap<K, V, Hash, KeyEqual>::find(_K const& crKey)
+{
+	if (m_entries.empty())
+		return end();
+
+	const _Slot& crSlot{ m_slots[probe(crKey, hash(crKey))] };
+
+	return (crSlot.index ? std::begin(m_entries) + (crSlot.index - 1) : end());
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+typename FlatHashMap<K, V, Hash, KeyEqual>::const_iterator FlatHashMap<K, V, Hash, KeyEqual>::find(_K const& crKey) const
+{
+	if (m_entries.empty())
+		return end();
+
+	const _Slot& crSlot{ m_slots[probe(crKey, hash(crKey))] };
+
+	return (crSlot.index ? std::cbegin(m_entries) + (crSlot.index - 1) : end());
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+inline typename FlatHashMap<K, V, Hash, KeyEqual>::_V& FlatHashMap<K, V, Hash, KeyEqual>::at(_K const& crKey)
+{
+	const auto it{ find(crKey) };
+	if (it == end())
+		throw std::out_of_range("Wrong key.");
+
+	return it->second;
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+inline typename FlatHashMap<K, V, Hash, KeyEqual>::_V const& FlatHashMap<K, V, Hash, KeyEqual>::at(_K const& crKey) const
+{
+	const auto it{ find(crKey) };
+	if (it == end())
+		throw std::out_of_range("Wrong key.");
+
+	return it->second;
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+template<typename... Args>
+std::pair<typename FlatHashMap<K, V, Hash, KeyEqual>::iterator, bool> FlatHashMap<K, V, Hash, KeyEqual>::try_emplace(_K const& crKey, Args&&... args)
+{
+	if (m_slots.empty() || (m_entries.size() + 1) > m_slots.size() / 4 * 3)
+		rehash(m_slots.empty() ? _min_slots : m_slots.size() * 2);
+
+	const std::uint32_t h{ hash(crKey) };
+	_Slot&              rSlot{ m_slots[probe(crKey, h)] };
+	if (rSlot.index)
+		return { std::begin(m_entries) + (rSlot.index - 1), false };
+
+	m_entries.emplace_back(std::piecewise_construct, std::forward_as_tuple(crKey), std::forward_as_tuple(std::forward<Args>(args)...));
+	rSlot = { h, static_cast<std::uint32_t>(m_entries.size()) };
+
+	return { std::prev(std::end(m_entries)), true };
+}
+
+template<typename K, typename V, typename Hash, typename KeyEqual>
+inline typename FlatHashMap<K, V, Hash, KeyEqual>::_V& FlatHashMap<K, V, Hash, KeyEqual>::operator[](_K const& crKey)
+{
+	return try_emplace(crKey).first->second;
+}
+
+#endif /* __FLAT_HASH_MAP_HPP_INCLUDED__ */
@@ -0,0 +1,212 @@
+#pragma once
+
+#ifndef __GENERATOR_HPP_INCLUDED__
+#define __GENERATOR_HPP_INCLUDED__
+
+#ifndef __cplusplus
+#error
+#error Must use C++ to compile.
+#error
+#endif /* __cplusplus */
+
+// Coroutine sources need C++20, without it the header is empty
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define STREAM_COROUTINES
+#endif /* __has_include(<coroutine>) */
+#endif /* __cpp_impl_coroutine */
+
+#ifdef STREAM_COROUTINES
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "Pipeline.hpp"
+
+// Sequence produced by a coroutine with co_yield. The body runs only while the next element is asked for,
+// so nothing is produced ahead and the input never has to exist as a whole. Single pass, move only.
+template<typename T>
+class Generator
+{
+	using _T = T;
+
+public:
+	class promise_type
+	{
+	public:
+		[[nodiscard]]
+		Generator get_return_object() noexcept { return Generator(std::coroutine_handle<promise_type>::from_promise(*this)); }
+
+		[[nodiscard]]
+		std::suspend_always initial_suspend() const noexcept { return {}; }
+
+		[[nodiscard]]
+		std::suspend_always final_suspend() const noexcept { return {}; }
+
+		// The element lives in the coroutine frame until it is resumed
+		std::suspend_always yield_value(std::remove_reference_t<_T> const& crVal) noexcept
+		{
+			m_pVal = std::addressof(crVal);
+
+			return {};
+		}
+
+		std::suspend_always yield_value(std::remove_reference_t<_T>&& rrVal) noexcept
+		{
+			m_pVal = std::addressof(rrVal);
+
+			return {};
+		}
+
+		void return_void() const noexcept { }
+
+		void unhandled_exception() noexcept { m_exception = std::current_exception(); }
+
+		// Generators only yield
+		template<typename U>
+		void await_transform(U&&) = delete;
+
+		[[nodiscard]]
+		_T const& value() const noexcept { return *m_pVal; }
+
+		void rethrow_if_failed() const
+		{
+			if (m_exception)
+				std::rethrow_exception(m_exception);
+		}
+
+	private:
+		std::remove_reference_t<_T> const* m_pVal{};
+		std::exception_ptr                 m_exception;
+	};
+
+	class iterator
+	{
+	public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type        = std::remove_cv_t<std::remove_reference_t<_T>>;
+		using difference_type   = std::ptrdiff_t;
+		using pointer           = value_type const*;
+		using reference         = value_type const&;
+
+		iterator() noexcept = default;
+		explicit iterator(std::coroutine_handle<promise_type> handle) noexcept : m_handle(handle) { }
+
+		[[nodiscard]]
+		reference operator*() const noexcept { return m_handle.promise().value(); }
+
+		[[nodiscard]]
+		pointer operator->() const noexcept { return std::addressof(**this); }
+
+		iterator& operator++()
+		{
+			m_handle.resume();
+			if (m_handle.done())
+				m_handle.promise().rethrow_if_failed();
+
+			return (*this);
+		}
+
+		void operator++(int) { ++(*this); }
+
+		// Any iterator equals end() once the coroutine has finished
+		[[nodiscard]]
+		friend bool operator==(iterator const& crLHS, iterator const& crRHS) noexcept { return (crLHS.done() == crRHS.done()); }
+
+		[[nodiscard]]
+		friend bool operator!=(iterator const& crLHS, iterator const& crRHS) noexcept { return !(crLHS == crRHS); }
+
+	private:
+		[[nodiscard]]
+		bool done() const noexcept { return (!m_handle || m_handle.done()); }
+
+		std::coroutine_handle<promise_type> m_handle;
+	};
+
+	Generator(Generator const&) = delete;
+	Generator(Generator&& rrOther) noexcept;
+
+	~Generator() noexcept;
+
+	Generator& operator=(Generator const&) = delete;
+	Generator& operator=(Generator&& rrOther) noexcept;
+
+	// Runs the coroutine up to the first element
+	[[nodiscard]]
+	iterator begin();
+
+	[[nodiscard]]
+	inline iterator end() const noexcept;
+
+private:
+	explicit Generator(std::coroutine_handle<promise_type> handle) noexcept;
+
+	std::coroutine_handle<promise_type> m_handle;
+};
+
+template<typename T>
+inline Generator<T>::Generator(std::coroutine_handle<promise_type> handle) noexcept :
+	m_handle(handle)
+{ }
+
+template<typename T>
+inline Generator<T>::Generator(Generator&& rrOther) noexcept :
+	m_handle(std::exchange(rrOther.m_handle, nullptr))
+{ }
+
+template<typename T>
+inline Generator<T>::~Generator() noexcept
+{
+	if (m_handle)
+		m_handle.destroy();
+}
+
+template<typename T>
+inline Generator<T>& Generator<T>::operator=(Generator&& rrOther) noexcept
+{
+	Generator tmp(std::move(rrOther));
+	std::swap(m_handle, tmp.m_handle);
+
+	return (*this);
+}
+
+template<typename T>
+inline typename Generator<T>::iterator Generator<T>::begin()
+{
+	if (m_handle && !m_handle.done())
+	{
+		m_handle.resume();
+		if (m_handle.done())
+			m_handle.promise().rethrow_if_failed();
+	}
+
+	return iterator(m_handle);
+}
+
+template<typename T>
+inline typename Generator<T>::iterator Generator<T>::end() const noexcept
+{
+	return iterator();
+}
+
+// Pipeline pulling the elements from the generator. It is consumed by the first terminal operation.
+template<typename T>
+[[nodiscard]]
+inline auto make_generator_pipeline(Generator<T> gen)
+{
+	auto push = [pGen = std::make_shared<Generator<T>>(std::move(gen))](auto&& sink)
+	{
+		for (auto const& crVal : *pGen)
+			sink(crVal);
+	};
+
+	return Pipeline<std::remove_cv_t<std::remove_reference_t<T>>, decltype(push)>(std::move(push));
+}
+
+#endif /* STREAM_COROUTINES */
+
+#endif /* __GENERATOR_HPP_INCLUDED__ */
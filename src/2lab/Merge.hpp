@@ -0,0 +1,217 @@
+#pragma once
+
+#ifndef __MERGE_HPP_INCLUDED__
+#define __MERGE_HPP_INCLUDED__
+
+#ifndef __cplusplus
+#error
+#error Must use C++ to compile.
+#error
+#endif /* __cplusplus */
+
+#include <algorithm>
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// Tournament tree over k sorted ranges: every internal node keeps the loser of the match played there, so taking
+// the next element replays a single leaf-to-root path, log2(k) comparisons against the stored losers.
+// Equal elements come out in the order of their ranges.
+template<typename Iter, typename Compare>
+class LoserTree
+{
+	using _Range = std::pair<Iter, Iter>;
+
+public:
+	LoserTree(std::vector<_Range> ranges, Compare comp);
+
+	[[nodiscard]]
+	inline bool empty() const noexcept;
+
+	// Range holding the smallest of the current fronts
+	[[nodiscard]]
+	inline std::size_t top() const noexcept;
+
+	// Iterator to the smallest front, valid until pop
+	[[nodiscard]]
+	inline Iter front() const noexcept;
+
+	void pop();
+
+private:
+	// Exhausted ranges lose to everything
+	[[nodiscard]]
+	inline bool less(std::size_t lhs, std::size_t rhs) const;
+
+	std::vector<_Range>      m_ranges;
+	std::vector<std::size_t> m_tree; // m_tree[0] is the winner, m_tree[n] the loser at the internal node n
+	Compare                  m_comp;
+};
+
+template<typename Iter, typename Compare>
+LoserTree<Iter, Compare>::LoserTree(std::vector<_Range> ranges, Compare comp) :
+	m_ranges(std::move(ranges)),
+	m_tree(m_ranges.size()),
+	m_comp(std::move(comp))
+{
+	const std::size_t k{ m_ranges.size() };
+	if (k < 2)
+		return;
+
+	// Leaves are the nodes k..2k-1, the winners are kept only while the tree is built
+	std::vector<std::size_t> winners(2 * k);
+	for (std::size_t i{}; i < k; ++i)
+		winners[k + i] = i;
+
+	for (std::size_t n{ k - 1 }; n; --n)
+	{
+		const std::size_t lhs{ winners[2 * n] };
+		const std::size_t rhs{ winners[2 * n + 1] };
+		const bool        left_wins{ less(lhs, rhs) };
+
+		winners[n] = (left_wins ? lhs : rhs);
+		m_tree[n]  = (left_wins ? rhs : lhs);
+	}
+
+	m_tree[0] = winners[1];
+}
+
+template<typename Iter, typename Compare>
+inline bool LoserTree<Iter, Compare>::less(std::size_t lhs, std::size_t rhs) const
+{
+	auto const& crLHS{ m_ranges[lhs] };
+	auto const& crRHS{ m_ranges[rhs] };
+	if (crLHS.first == crLHS.second)
+		return false;
+	if (crRHS.first == crRHS.second)
+		return true;
+
+	if (m_comp(*crLHS.first, *crRHS.first))
+		return true;
+	if (m_comp(*crRHS.first, *crLHS.first))
+		return false;
+
+	return (lhs < rhs);
+}
+
+template<typename Iter, typename Compare>
+inline bool LoserTree<Iter, Compare>::empty() const noexcept
+{
+	return (m_ranges.empty() || m_ranges[m_tree[0]].first == m_ranges[m_tree[0]].second);
+}
+
+template<typename Iter, typename Compare>
+inline std::size_t LoserTree<Iter, Compare>::top() const noexcept
+{
+	return m_tree[0];
+}
+
+template<typename Iter, typename Compare>
+inline Iter LoserTree<Iter, Compare>::front() const noexcept
+{
+	return m_ranges[m_tree[0]].first;
+}
+
+template<typename Iter, typename Compare>
+void LoserTree<Iter, Compare>::pop()
+{
+	const std::size_t k{ m_ranges.size() };
+
+	std::size_t winner{ m_tree[0] };
+	++m_ranges[winner].first;
+
+	for (std::size_t n{ (winner + k) / 2 }; n; n /= 2)
+		if (less(m_tree[n], winner))
+			std::swap(m_tree[n], winner);
+
+	m_tree[0] = winner;
+}
+
+// Moves the elements of the sorted ranges to out in sorted order and returns the end of the output
+template<typename Iter, typename OutIter, typename Compare>
+OutIter merge_ranges(std::vector<std::pair<Iter, Iter>> ranges, OutIter out, Compare comp)
+{
+	ranges.erase(std::remove_if(std::begin(ranges), std::end(ranges), [](auto const& crRange) { return crRange.first == crRange.second; }), std::end(ranges));
+
+	if (ranges.size() == 1)
+		return std::move(ranges[0].first, ranges[0].second, out);
+
+	for (LoserTree<Iter, Compare> tree(std::move(ranges), std::move(comp)); !tree.empty(); tree.pop())
+		*out++ = std::move(*tree.front());
+
+	return out;
+}
+
+// Cut through the sorted ranges right before the element at pos of the range at index, in the order merge_ranges
+// produces: elements equal to it go to the left in the ranges before index and to the right in the ranges after it.
+// Returns how many elements of every range are on the left.
+template<typename Iter, typename Compare>
+[[nodiscard]]
+std::vector<std::size_t> merge_cut(std::vector<std::pair<Iter, Iter>> const& crRanges, std::size_t index, std::size_t pos, Compare comp)
+{
+	auto const& crPivot{ *std::next(crRanges[index].first, pos) };
+
+	std::vector<std::size_t> ret_val(crRanges.size());
+	for (std::size_t i{}; i < crRanges.size(); ++i)
+	{
+		auto [first, last] = crRanges[i];
+		if (i == index)
+			ret_val[i] = pos;
+		else if (i < index)
+			ret_val[i] = static_cast<std::size_t>(std::distance(first, std::upper_bound(first, last, crPivot, comp)));
+		else
+			ret_val[i] = static_cast<std::size_t>(std::distance(first, std::lower_bound(first, last, crPivot, comp)));
+	}
+
+	return ret_val;
+}
+
+// Splits the merge of the sorted ranges into at most nParts independent merges of about the same size.
+// Returns nParts + 1 cuts as for merge_cut, the first one at the start of every range and the last one at the end.
+template<typename Iter, typename Compare>
+[[nodiscard]]
+std::vector<std::vector<std::size_t>> merge_split(std::vector<std::pair<Iter, Iter>> const& crRanges, std::size_t nParts, Compare comp)
+{
+	const std::size_t k{ crRanges.size() };
+
+	std::vector<std::size_t> sizes(k);
+	std::size_t              total{};
+	for (std::size_t i{}; i < k; ++i)
+		total += (sizes[i] = static_cast<std::size_t>(std::distance(crRanges[i].first, crRanges[i].second)));
+
+	// Every range offers evenly spaced candidates, the ones at multiples of total / nParts in merged order become the cuts
+	std::vector<std::pair<std::size_t, std::size_t>> samples;
+	for (std::size_t i{}; i < k; ++i)
+		for (std::size_t part{ 1 }; part < nParts; ++part)
+			if (const std::size_t pos{ sizes[i] * part / nParts }; pos < sizes[i])
+				samples.emplace_back(i, pos);
+
+	std::sort(std::begin(samples), std::end(samples), [&](auto const& crLHS, auto const& crRHS)
+	{
+		auto const& crL{ *std::next(crRanges[crLHS.first].first, crLHS.second) };
+		auto const& crR{ *std::next(crRanges[crRHS.first].first, crRHS.second) };
+		if (comp(crL, crR))
+			return true;
+		if (comp(crR, crL))
+			return false;
+
+		return (std::tie(crLHS.first, crLHS.second) < std::tie(crRHS.first, crRHS.second));
+	});
+
+	std::vector<std::vector<std::size_t>> ret_val;
+	ret_val.emplace_back(k);
+	for (std::size_t part{ 1 }; part < nParts && !samples.empty(); ++part)
+	{
+		auto const& crSample{ samples[samples.size() * part / nParts] };
+
+		auto cut{ merge_cut(crRanges, crSample.first, crSample.second, comp) };
+		if (cut != ret_val.back())
+			ret_val.push_back(std::move(cut));
+	}
+	ret_val.push_back(std::move(sizes));
+
+	return ret_val;
+}
+
+#endif /* __MERGE_HPP_INCLUDED__ */
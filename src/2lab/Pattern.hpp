@@ -0,0 +1,205 @@
+#pragma once
+
+#ifndef __PATTERN_HPP_INCLUDED__
+#define __PATTERN_HPP_INCLUDED__
+
+#ifndef __cplusplus
+#error
+#error Must use C++ to compile.
+#error
+#endif /* __cplusplus */
+
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "Arena.hpp"
+#include "Tokenizer.hpp"
+
+// Sequence of values compiled for Knuth-Morris-Pratt search: every scan is O(n + m), overlapping matches included.
+// Values are compared with operator==, so "007" matches the int 7.
+template<typename T>
+class Pattern
+{
+	using _T = T;
+
+	static constexpr bool _string_view = std::is_same_v<_T, std::string_view>;
+
+public:
+	using value_type = T;
+
+	// Whitespace separated values, parsed as _T. Pattern<std::string_view> copies them, str may go away afterwards
+	explicit Pattern(std::string_view str);
+	// Values are taken as they are, string_views have to outlive the pattern
+	Pattern(std::initializer_list<_T> list);
+
+	template<typename Iter>
+	Pattern(Iter first, Iter last);
+
+	[[nodiscard]]
+	inline std::size_t size() const noexcept;
+
+	// First match in [first, last) or last
+	template<typename Iter>
+	[[nodiscard]]
+	Iter find(Iter first, Iter last) const;
+
+	// Offsets from first of all the matches
+	template<typename Iter>
+	[[nodiscard]]
+	std::vector<std::size_t> find_all(Iter first, Iter last) const;
+
+	template<typename Iter>
+	[[nodiscard]]
+	std::size_t count(Iter first, Iter last) const;
+
+	// Calls on_match(offset) for every match in order until it returns false
+	template<typename Iter, typename F>
+	void scan(Iter first, Iter last, F&& on_match) const;
+
+private:
+	void compile();
+
+	std::vector<_T>              m_vals;
+	std::vector<std::size_t>     m_fail;   // Length of the longest proper border of m_vals[0, i]
+	std::shared_ptr<StringArena> m_pArena; // Values parsed by Pattern<std::string_view>, shared by the copies
+};
+
+template<typename T>
+inline Pattern<T>::Pattern(std::string_view str) :
+	m_vals(),
+	m_fail(),
+	m_pArena()
+{
+	if constexpr (_string_view)
+		m_pArena = std::make_shared<StringArena>(str.size());
+
+	Tokenizer tokens(str);
+	for (_T tmp{}; tokens.next(tmp); tmp = _T{})
+		if constexpr (_string_view)
+			m_vals.push_back(m_pArena->store(tmp));
+		else
+			m_vals.push_back(std::move(tmp));
+
+	compile();
+}
+
+template<typename T>
+inline Pattern<T>::Pattern(std::initializer_list<_T> list) :
+	m_vals(list.begin(), list.end()),
+	m_fail(),
+	m_pArena()
+{
+	compile();
+}
+
+template<typename T>
+template<typename Iter>
+inline Pattern<T>::Pattern(Iter first, Iter last) :
+	m_vals(first, last),
+	m_fail(),
+	m_pArena()
+{
+	compile();
+}
+
+template<typename T>
+inline std::size_t Pattern<T>::size() const noexcept
+{
+	return m_vals.size();
+}
+
+template<typename T>
+void Pattern<T>::compile()
+{
+	if (m_vals.empty())
+		throw std::runtime_error("Wrong pattern.");
+
+	m_fail.assign(m_vals.size(), 0);
+	for (std::size_t i{ 1 }, k{}; i < m_vals.size(); ++i)
+	{
+		while (k && !(m_vals[i] == m_vals[k]))
+			k = m_fail[k - 1];
+
+		if (m_vals[i] == m_vals[k])
+			++k;
+
+		m_fail[i] = k;
+	}
+}
+
+template<typename T>
+template<typename Iter, typename F>
+void Pattern<T>::scan(Iter first, Iter last, F&& on_match) const
+{
+	const std::size_t size{ m_vals.size() };
+
+	std::size_t k{};
+	std::size_t pos{};
+	for (; first != last; ++first, ++pos)
+	{
+		while (k && !(*first == m_vals[k]))
+			k = m_fail[k - 1];
+
+		if (*first == m_vals[k] && ++k == size)
+		{
+			if (!on_match(pos + 1 - size))
+				return;
+
+			k = m_fail[k - 1];
+		}
+	}
+}
+
+template<typename T>
+template<typename Iter>
+inline Iter Pattern<T>::find(Iter first, Iter last) const
+{
+	std::size_t offset{};
+	bool        found{};
+	scan(first, last, [&](std::size_t pos)
+	{
+		offset = pos;
+		found  = true;
+
+		return false;
+	});
+
+	return (found ? std::next(first, offset) : last);
+}
+
+template<typename T>
+template<typename Iter>
+inline std::vector<std::size_t> Pattern<T>::find_all(Iter first, Iter last) const
+{
+	std::vector<std::size_t> ret_val;
+	scan(first, last, [&](std::size_t pos)
+	{
+		ret_val.push_back(pos);
+
+		return true;
+	});
+
+	return ret_val;
+}
+
+template<typename T>
+template<typename Iter>
+inline std::size_t Pattern<T>::count(Iter first, Iter last) const
+{
+	std::size_t ret_val{};
+	scan(first, last, [&](std::size_t)
+	{
+		++ret_val;
+
+		return true;
+	});
+
+	return ret_val;
+}
+
+#endif /* __PATTERN_HPP_INCLUDED__ */
@@ -0,0 +1,131 @@
+#pragma once
+
+#ifndef __PIPELINE_HPP_INCLUDED__
+#define __PIPELINE_HPP_INCLUDED__
+
+#ifndef __cplusplus
+#error
+#error Must use C++ to compile.
+#error
+#endif /* __cplusplus */
+
+#include <vector>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+// Lazy chain of stages. Nothing runs until a terminal operation (reduce, collect, for_each) pushes the source elements
+// through all stages in a single pass. Push is a callable taking a sink; the sink is called with every element
+// (lvalue for the source ones, rvalue for the computed ones).
+template<typename T, typename Push>
+class Pipeline
+{
+	using _T = T;
+	using _Push = Push;
+
+public:
+	using value_type = T;
+
+	explicit Pipeline(_Push push) noexcept(std::is_nothrow_move_constructible_v<_Push>);
+
+	template<typename F>
+	[[nodiscard]]
+	auto map(F map_func) const;
+
+	template<typename F>
+	[[nodiscard]]
+	auto where(F where_func) const;
+
+	template<typename U, typename F>
+	[[nodiscard]]
+	U reduce(F reduce_func, U init_val);
+
+	template<typename Cont = std::vector<_T>>
+	[[nodiscard]]
+	Cont collect();
+
+	template<typename F>
+	void for_each(F func);
+
+private:
+	_Push m_push;
+};
+
+template<typename T, typename Push>
+inline Pipeline<T, Push>::Pipeline(_Push push) noexcept(std::is_nothrow_move_constructible_v<_Push>) :
+	m_push(std::move(push))
+{ }
+
+template<typename T, typename Push>
+template<typename F>
+inline auto Pipeline<T, Push>::map(F map_func) const
+{
+	using _U = std::decay_t<std::invoke_result_t<F&, _T&>>;
+
+	auto push = [prev = m_push, map_func = std::move(map_func)](auto&& sink) mutable
+	{
+		prev([&](auto&& val) { sink(_U(std::invoke(map_func, val))); });
+	};
+
+	return Pipeline<_U, decltype(push)>(std::move(push));
+}
+
+template<typename T, typename Push>
+template<typename F>
+inline auto Pipeline<T, Push>::where(F where_func) const
+{
+	auto push = [prev = m_push, where_func = std::move(where_func)](auto&& sink) mutable
+	{
+		prev([&](auto&& val)
+		{
+			if (std::invoke(where_func, val))
+				sink(std::forward<decltype(val)>(val));
+		});
+	};
+
+	return Pipeline<_T, decltype(push)>(std::move(push));
+}
+
+template<typename T, typename Push>
+template<typename U, typename F>
+inline U Pipeline<T, Push>::reduce(F reduce_func, U init_val)
+{
+	U ret_val{ std::move(init_val) };
+	m_push([&](auto&& val) { ret_val = std::invoke(reduce_func, val, ret_val); });
+
+	return ret_val;
+}
+
+template<typename T, typename Push>
+template<typename Cont>
+inline Cont Pipeline<T, Push>::collect()
+{
+	Cont cont;
+	m_push([&](auto&& val) { cont.push_back(std::forward<decltype(val)>(val)); });
+
+	return cont;
+}
+
+template<typename T, typename Push>
+template<typename F>
+inline void Pipeline<T, Push>::for_each(F func)
+{
+	m_push([&](auto&& val) { std::invoke(func, std::forward<decltype(val)>(val)); });
+}
+
+// Pipeline over [first, last) which has to outlive it
+template<typename Iter>
+[[nodiscard]]
+inline auto make_pipeline(Iter first, Iter last)
+{
+	auto push = [first, last](auto&& sink)
+	{
+		for (auto it{ first }; it != last; ++it)
+			sink(*it);
+	};
+
+	return Pipeline<typename std::iterator_traits<Iter>::value_type, decltype(push)>(std::move(push));
+}
+
+#endif /* __PIPELINE_HPP_INCLUDED__ */
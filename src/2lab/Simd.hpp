@@ -0,0 +1,654 @@
+#pragma once
+
+#ifndef __SIMD_HPP_INCLUDED__
+#define __SIMD_HPP_INCLUDED__
+
+#ifndef __cplusplus
+#error
+#error Must use C++ to compile.
+#error
+#endif /* __cplusplus */
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define SIMD_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif /* _MSC_VER */
+#endif /* x86 */
+
+// Vectorized primitives for int, float and double arrays, dispatched at runtime to AVX-512, AVX2 or plain loops.
+// Other types always take the plain loops.
+namespace simd
+{
+	enum class cmp
+	{
+		less,
+		less_equal,
+		greater,
+		greater_equal,
+		equal,
+		not_equal
+	};
+
+	enum class isa
+	{
+		scalar,
+		avx2,
+		avx512
+	};
+
+	template<typename T>
+	inline constexpr bool is_vectorizable_v = std::is_same_v<T, int> || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+	// Best instruction set supported by both the CPU and the OS
+	[[nodiscard]]
+	inline isa active_isa() noexcept;
+
+	template<cmp Op, typename T>
+	[[nodiscard]]
+	constexpr bool compare(T const& crLHS, T const& crRHS) noexcept;
+
+	template<typename T>
+	[[nodiscard]]
+	bool compare(cmp op, T const& crLHS, T const& crRHS) noexcept;
+
+	// p[i] = a * p[i] + b, integers wrap around
+	template<typename T>
+	void affine(T* p, std::size_t count, T a, T b) noexcept;
+
+	// Copies the elements for which `x op value` holds to pDst keeping their order and returns how many there are.
+	// pDst may be pSrc and has to have room for count elements.
+	template<typename T>
+	[[nodiscard]]
+	std::size_t filter(T const* pSrc, std::size_t count, T* pDst, cmp op, T value) noexcept;
+
+	// Floating point sums are added lane by lane, so they may round differently than a sequential loop
+	template<typename T>
+	[[nodiscard]]
+	T sum(T const* p, std::size_t count) noexcept;
+
+	// count has to be positive. NaN values are skipped, the result is NaN only if every value is.
+	template<typename T>
+	[[nodiscard]]
+	T min(T const* p, std::size_t count) noexcept;
+
+	template<typename T>
+	[[nodiscard]]
+	T max(T const* p, std::size_t count) noexcept;
+
+	template<typename T>
+	[[nodiscard]]
+	std::size_t count(T const* p, std::size_t size, cmp op, T value) noexcept;
+
+	namespace scalar
+	{
+		template<typename T>
+		[[nodiscard]]
+		constexpr T add(T lhs, T rhs) noexcept
+		{
+			if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+				return static_cast<T>(static_cast<std::make_unsigned_t<T>>(lhs) + static_cast<std::make_unsigned_t<T>>(rhs));
+			else
+				return static_cast<T>(lhs + rhs);
+		}
+
+		template<typename T>
+		[[nodiscard]]
+		constexpr T mul(T lhs, T rhs) noexcept
+		{
+			if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+				return static_cast<T>(static_cast<std::make_unsigned_t<T>>(lhs) * static_cast<std::make_unsigned_t<T>>(rhs));
+			else
+				return static_cast<T>(lhs * rhs);
+		}
+
+		template<typename Iter, typename T>
+		void affine(Iter first, Iter last, T a, T b) noexcept
+		{
+			for (; first != last; ++first)
+				*first = add(mul(a, *first), b);
+		}
+
+		template<cmp Op, typename Iter, typename OutIter, typename T>
+		std::size_t filter(Iter first, Iter last, OutIter out, T const& crValue) noexcept
+		{
+			std::size_t ret_val{};
+			for (; first != last; ++first)
+				if (compare<Op>(*first, crValue))
+				{
+					*out++ = *first;
+					++ret_val;
+				}
+
+			return ret_val;
+		}
+
+		template<typename Iter, typename T>
+		[[nodiscard]]
+		T sum(Iter first, Iter last, T init_val) noexcept
+		{
+			for (; first != last; ++first)
+				init_val = add(init_val, *first);
+
+			return init_val;
+		}
+
+		template<typename T>
+		[[nodiscard]]
+		constexpr bool is_nan(T const& crVal) noexcept
+		{
+			if constexpr (std::is_floating_point_v<T>)
+				return (crVal != crVal);
+			else
+				return false;
+		}
+
+		// NaN values are skipped, a NaN init_val is replaced by the first other value
+		template<typename Iter, typename T>
+		[[nodiscard]]
+		T min(Iter first, Iter last, T init_val) noexcept
+		{
+			for (; first != last; ++first)
+				if (*first < init_val || is_nan(init_val))
+					init_val = *first;
+
+			return init_val;
+		}
+
+		template<typename Iter, typename T>
+		[[nodiscard]]
+		T max(Iter first, Iter last, T init_val) noexcept
+		{
+			for (; first != last; ++first)
+				if (init_val < *first || is_nan(init_val))
+					init_val = *first;
+
+			return init_val;
+		}
+
+		template<cmp Op, typename Iter, typename T>
+		[[nodiscard]]
+		std::size_t count(Iter first, Iter last, T const& crValue) noexcept
+		{
+			std::size_t ret_val{};
+			for (; first != last; ++first)
+				ret_val += compare<Op>(*first, crValue);
+
+			return ret_val;
+		}
+	} // namespace scalar
+
+	namespace detail
+	{
+		// Calls func(std::integral_constant<cmp, op>), so that kernels get the comparison as a template argument
+		template<typename F>
+		decltype(auto) with_cmp(cmp op, F&& func)
+		{
+			switch (op)
+			{
+			case cmp::less:          return func(std::integral_constant<cmp, cmp::less>());
+			case cmp::less_equal:    return func(std::integral_constant<cmp, cmp::less_equal>());
+			case cmp::greater:       return func(std::integral_constant<cmp, cmp::greater>());
+			case cmp::greater_equal: return func(std::integral_constant<cmp, cmp::greater_equal>());
+			case cmp::equal:         return func(std::integral_constant<cmp, cmp::equal>());
+			default:                 return func(std::integral_constant<cmp, cmp::not_equal>());
+			}
+		}
+
+		[[nodiscard]]
+		inline unsigned popcount(unsigned mask) noexcept
+		{
+			return static_cast<unsigned>(std::bitset<32>(mask).count());
+		}
+
+		// Permutation moving the lanes selected by every 8-bit mask to the front, for 32-bit lanes
+		[[nodiscard]]
+		constexpr std::array<std::array<std::uint32_t, 8>, 256> make_compress_lut32() noexcept
+		{
+			std::array<std::array<std::uint32_t, 8>, 256> lut{};
+			for (std::uint32_t mask{}; mask < 256; ++mask)
+				for (std::uint32_t lane{}, k{}; lane < 8; ++lane)
+					if (mask & (1U << lane))
+						lut[mask][k++] = lane;
+
+			return lut;
+		}
+
+		// Same for 4-bit masks over 64-bit lanes, expressed as pairs of 32-bit lanes
+		[[nodiscard]]
+		constexpr std::array<std::array<std::uint32_t, 8>, 16> make_compress_lut64() noexcept
+		{
+			std::array<std::array<std::uint32_t, 8>, 16> lut{};
+			for (std::uint32_t mask{}; mask < 16; ++mask)
+				for (std::uint32_t lane{}, k{}; lane < 4; ++lane)
+					if (mask & (1U << lane))
+					{
+						lut[mask][k++] = 2 * lane;
+						lut[mask][k++] = 2 * lane + 1;
+					}
+
+			return lut;
+		}
+
+		inline constexpr auto compress_lut32{ make_compress_lut32() };
+		inline constexpr auto compress_lut64{ make_compress_lut64() };
+	} // namespace detail
+} // namespace simd
+
+template<simd::cmp Op, typename T>
+constexpr bool simd::compare(T const& crLHS, T const& crRHS) noexcept
+{
+	if constexpr (Op == cmp::less)
+		return (crLHS < crRHS);
+	else if constexpr (Op == cmp::less_equal)
+		return (crLHS <= crRHS);
+	else if constexpr (Op == cmp::greater)
+		return (crLHS > crRHS);
+	else if constexpr (Op == cmp::greater_equal)
+		return (crLHS >= crRHS);
+	else if constexpr (Op == cmp::equal)
+		return (crLHS == crRHS);
+	else
+		return (crLHS != crRHS);
+}
+
+template<typename T>
+inline bool simd::compare(cmp op, T const& crLHS, T const& crRHS) noexcept
+{
+	return detail::with_cmp(op, [&](auto op_tag) { return compare<decltype(op_tag)::value>(crLHS, crRHS); });
+}
+
+#ifdef SIMD_X86
+
+// MSVC allows any intrinsic in any function, GCC and Clang have to be told which instruction set the kernels are for.
+// GCC would also fuse the multiplications and additions of AVX-512 kernels into FMA, which rounds differently than the
+// plain loops.
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#pragma GCC optimize("fp-contract=off")
+#endif /* __clang__ */
+namespace simd::detail::avx2
+{
+	template<typename T>
+	struct vec;
+
+	template<>
+	struct vec<int>
+	{
+		using type = __m256i;
+
+		static constexpr std::size_t lanes = 8;
+
+		static type load(int const* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p)); }
+		static void store(int* p, type v) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+		static type set1(int val) noexcept { return _mm256_set1_epi32(val); }
+		static type add(type lhs, type rhs) noexcept { return _mm256_add_epi32(lhs, rhs); }
+		static type mul(type lhs, type rhs) noexcept { return _mm256_mullo_epi32(lhs, rhs); }
+		static type min(type lhs, type rhs) noexcept { return _mm256_min_epi32(lhs, rhs); }
+		static type max(type lhs, type rhs) noexcept { return _mm256_max_epi32(lhs, rhs); }
+
+		static unsigned mask(type v) noexcept { return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(v))); }
+
+		template<cmp Op>
+		static unsigned compare(type lhs, type rhs) noexcept
+		{
+			if constexpr (Op == cmp::less)
+				return mask(_mm256_cmpgt_epi32(rhs, lhs));
+			else if constexpr (Op == cmp::less_equal)
+				return ~mask(_mm256_cmpgt_epi32(lhs, rhs)) & 0xFFu;
+			else if constexpr (Op == cmp::greater)
+				return mask(_mm256_cmpgt_epi32(lhs, rhs));
+			else if constexpr (Op == cmp::greater_equal)
+				return ~mask(_mm256_cmpgt_epi32(rhs, lhs)) & 0xFFu;
+			else if constexpr (Op == cmp::equal)
+				return mask(_mm256_cmpeq_epi32(lhs, rhs));
+			else
+				return ~mask(_mm256_cmpeq_epi32(lhs, rhs)) & 0xFFu;
+		}
+
+		// Writes all the lanes, the selected ones first
+		static void compress_store(int* p, type v, unsigned mask) noexcept
+		{
+			const __m256i perm{ _mm256_loadu_si256(reinterpret_cast<__m256i const*>(compress_lut32[mask].data())) };
+			store(p, _mm256_permutevar8x32_epi32(v, perm));
+		}
+	};
+
+	template<>
+	struct vec<float>
+	{
+		using type = __m256;
+
+		static constexpr std::size_t lanes = 8;
+
+		static type load(float const* p) noexcept { return _mm256_loadu_ps(p); }
+		static void store(float* p, type v) noexcept { _mm256_storeu_ps(p, v); }
+		static type set1(float val) noexcept { return _mm256_set1_ps(val); }
+		static type add(type lhs, type rhs) noexcept { return _mm256_add_ps(lhs, rhs); }
+		static type mul(type lhs, type rhs) noexcept { return _mm256_mul_ps(lhs, rhs); }
+		static type min(type lhs, type rhs) noexcept { return _mm256_min_ps(lhs, rhs); }
+		static type max(type lhs, type rhs) noexcept { return _mm256_max_ps(lhs, rhs); }
+
+		// NaN compares like the scalar operators: false except for not_equal
+		template<cmp Op>
+		static unsigned compare(type lhs, type rhs) noexcept
+		{
+			constexpr int predicate{ Op == cmp::less ? _CMP_LT_OQ : Op == cmp::less_equal ? _CMP_LE_OQ : Op == cmp::greater ? _CMP_GT_OQ :
+			                         Op == cmp::greater_equal ? _CMP_GE_OQ : Op == cmp::equal ? _CMP_EQ_OQ : _CMP_NEQ_UQ };
+
+			return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(lhs, rhs, predicate)));
+		}
+
+		static void compress_store(float* p, type v, unsigned mask) noexcept
+		{
+			const __m256i perm{ _mm256_loadu_si256(reinterpret_cast<__m256i const*>(compress_lut32[mask].data())) };
+			store(p, _mm256_permutevar8x32_ps(v, perm));
+		}
+	};
+
+	template<>
+	struct vec<double>
+	{
+		using type = __m256d;
+
+		static constexpr std::size_t lanes = 4;
+
+		static type load(double const* p) noexcept { return _mm256_loadu_pd(p); }
+		static void store(double* p, type v) noexcept { _mm256_storeu_pd(p, v); }
+		static type set1(double val) noexcept { return _mm256_set1_pd(val); }
+		static type add(type lhs, type rhs) noexcept { return _mm256_add_pd(lhs, rhs); }
+		static type mul(type lhs, type rhs) noexcept { return _mm256_mul_pd(lhs, rhs); }
+		static type min(type lhs, type rhs) noexcept { return _mm256_min_pd(lhs, rhs); }
+		static type max(type lhs, type rhs) noexcept { return _mm256_max_pd(lhs, rhs); }
+
+		template<cmp Op>
+		static unsigned compare(type lhs, type rhs) noexcept
+		{
+			constexpr int predicate{ Op == cmp::less ? _CMP_LT_OQ : Op == cmp::less_equal ? _CMP_LE_OQ : Op == cmp::greater ? _CMP_GT_OQ :
+			                         Op == cmp::greater_equal ? _CMP_GE_OQ : Op == cmp::equal ? _CMP_EQ_OQ : _CMP_NEQ_UQ };
+
+			return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, predicate)));
+		}
+
+		static void compress_store(double* p, type v, unsigned mask) noexcept
+		{
+			const __m256i perm{ _mm256_loadu_si256(reinterpret_cast<__m256i const*>(compress_lut64[mask].data())) };
+			store(p, _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(v), perm)));
+		}
+	};
+
+#include "SimdKernels.inl"
+} // namespace simd::detail::avx2
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif /* __clang__ */
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx512f"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#pragma GCC optimize("fp-contract=off")
+#endif /* __clang__ */
+namespace simd::detail::avx512
+{
+	template<typename T>
+	struct vec;
+
+	// min and max use the zero-masked forms: the unmasked ones merge into an undefined register, which GCC reports as
+	// -Wmaybe-uninitialized
+	template<>
+	struct vec<int>
+	{
+		using type = __m512i;
+
+		static constexpr std::size_t lanes = 16;
+
+		static type load(int const* p) noexcept { return _mm512_loadu_si512(p); }
+		static void store(int* p, type v) noexcept { _mm512_storeu_si512(p, v); }
+		static type set1(int val) noexcept { return _mm512_set1_epi32(val); }
+		static type add(type lhs, type rhs) noexcept { return _mm512_add_epi32(lhs, rhs); }
+		static type mul(type lhs, type rhs) noexcept { return _mm512_mullo_epi32(lhs, rhs); }
+		static type min(type lhs, type rhs) noexcept { return _mm512_maskz_min_epi32(0xFFFF, lhs, rhs); }
+		static type max(type lhs, type rhs) noexcept { return _mm512_maskz_max_epi32(0xFFFF, lhs, rhs); }
+
+		template<cmp Op>
+		static unsigned compare(type lhs, type rhs) noexcept
+		{
+			constexpr int predicate{ Op == cmp::less ? _MM_CMPINT_LT : Op == cmp::less_equal ? _MM_CMPINT_LE : Op == cmp::greater ? _MM_CMPINT_NLE :
+			                         Op == cmp::greater_equal ? _MM_CMPINT_NLT : Op == cmp::equal ? _MM_CMPINT_EQ : _MM_CMPINT_NE };
+
+			return static_cast<unsigned>(_mm512_cmp_epi32_mask(lhs, rhs, predicate));
+		}
+
+		// Compressing in a register and storing all the lanes is faster than the masked compressing store on some CPUs
+		static void compress_store(int* p, type v, unsigned mask) noexcept
+		{
+			store(p, _mm512_maskz_compress_epi32(static_cast<__mmask16>(mask), v));
+		}
+	};
+
+	template<>
+	struct vec<float>
+	{
+		using type = __m512;
+
+		static constexpr std::size_t lanes = 16;
+
+		static type load(float const* p) noexcept { return _mm512_loadu_ps(p); }
+		static void store(float* p, type v) noexcept { _mm512_storeu_ps(p, v); }
+		static type set1(float val) noexcept { return _mm512_set1_ps(val); }
+		static type add(type lhs, type rhs) noexcept { return _mm512_add_ps(lhs, rhs); }
+		static type mul(type lhs, type rhs) noexcept { return _mm512_mul_ps(lhs, rhs); }
+		static type min(type lhs, type rhs) noexcept { return _mm512_maskz_min_ps(0xFFFF, lhs, rhs); }
+		static type max(type lhs, type rhs) noexcept { return _mm512_maskz_max_ps(0xFFFF, lhs, rhs); }
+
+		template<cmp Op>
+		static unsigned compare(type lhs, type rhs) noexcept
+		{
+			constexpr int predicate{ Op == cmp::less ? _CMP_LT_OQ : Op == cmp::less_equal ? _CMP_LE_OQ : Op == cmp::greater ? _CMP_GT_OQ :
+			                         Op == cmp::greater_equal ? _CMP_GE_OQ : Op == cmp::equal ? _CMP_EQ_OQ : _CMP_NEQ_UQ };
+
+			return static_cast<unsigned>(_mm512_cmp_ps_mask(lhs, rhs, predicate));
+		}
+
+		static void compress_store(float* p, type v, unsigned mask) noexcept
+		{
+			store(p, _mm512_maskz_compress_ps(static_cast<__mmask16>(mask), v));
+		}
+	};
+
+	template<>
+	struct vec<double>
+	{
+		using type = __m512d;
+
+		static constexpr std::size_t lanes = 8;
+
+		static type load(double const* p) noexcept { return _mm512_loadu_pd(p); }
+		static void store(double* p, type v) noexcept { _mm512_storeu_pd(p, v); }
+		static type set1(double val) noexcept { return _mm512_set1_pd(val); }
+		static type add(type lhs, type rhs) noexcept { return _mm512_add_pd(lhs, rhs); }
+		static type mul(type lhs, type rhs) noexcept { return _mm512_mul_pd(lhs, rhs); }
+		static type min(type lhs, type rhs) noexcept { return _mm512_maskz_min_pd(0xFF, lhs, rhs); }
+		static type max(type lhs, type rhs) noexcept { return _mm512_maskz_max_pd(0xFF, lhs, rhs); }
+
+		template<cmp Op>
+		static unsigned compare(type lhs, type rhs) noexcept
+		{
+			constexpr int predicate{ Op == cmp::less ? _CMP_LT_OQ : Op == cmp::less_equal ? _CMP_LE_OQ : Op == cmp::greater ? _CMP_GT_OQ :
+			                         Op == cmp::greater_equal ? _CMP_GE_OQ : Op == cmp::equal ? _CMP_EQ_OQ : _CMP_NEQ_UQ };
+
+			return static_cast<unsigned>(_mm512_cmp_pd_mask(lhs, rhs, predicate));
+		}
+
+		static void compress_store(double* p, type v, unsigned mask) noexcept
+		{
+			store(p, _mm512_maskz_compress_pd(static_cast<__mmask8>(mask), v));
+		}
+	};
+
+#include "SimdKernels.inl"
+} // namespace simd::detail::avx512
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif /* __clang__ */
+
+#endif /* SIMD_X86 */
+
+inline simd::isa simd::active_isa() noexcept
+{
+	static const isa s_isa{ []
+	{
+#if defined(SIMD_X86) && defined(_MSC_VER)
+		int regs[4];
+		__cpuid(regs, 0);
+		const int maxLeaf{ regs[0] };
+
+		__cpuid(regs, 1);
+		const bool osxsave{ ((regs[2] >> 27) & 1) != 0 };
+		const bool avx{ ((regs[2] >> 28) & 1) != 0 };
+
+		// The OS has to save YMM (bits 1-2) and ZMM (bits 5-7) state on context switches
+		const unsigned long long xcr0{ (osxsave && avx) ? _xgetbv(0) : 0ULL };
+
+		bool avx2{}, avx512f{};
+		if (maxLeaf >= 7)
+		{
+			__cpuidex(regs, 7, 0);
+			avx2    = ((regs[1] >> 5) & 1) != 0;
+			avx512f = ((regs[1] >> 16) & 1) != 0;
+		}
+
+		if (avx512f && (xcr0 & 0xE6) == 0xE6)
+			return isa::avx512;
+		else if (avx2 && (xcr0 & 0x6) == 0x6)
+			return isa::avx2;
+		else
+			return isa::scalar;
+#elif defined(SIMD_X86)
+		// Checks the OS support as well
+		__builtin_cpu_init();
+
+		if (__builtin_cpu_supports("avx512f"))
+			return isa::avx512;
+		else if (__builtin_cpu_supports("avx2"))
+			return isa::avx2;
+		else
+			return isa::scalar;
+#else
+		return isa::scalar;
+#endif /* SIMD_X86 */
+	}() };
+
+	return s_isa;
+}
+
+// Calls the kernel of the active instruction set, e.g. SIMD_DISPATCH(sum, p, count) for simd::detail::avx2::sum(p, count)
+#ifdef SIMD_X86
+#define SIMD_DISPATCH(kernel, ...)                        \
+	switch (active_isa())                                 \
+	{                                                     \
+	case isa::avx512: return detail::avx512::kernel(__VA_ARGS__); \
+	case isa::avx2:   return detail::avx2::kernel(__VA_ARGS__);   \
+	default:          break;                              \
+	}
+#else
+#define SIMD_DISPATCH(kernel, ...)
+#endif /* SIMD_X86 */
+
+template<typename T>
+inline void simd::affine(T* p, std::size_t count, T a, T b) noexcept
+{
+	if constexpr (is_vectorizable_v<T>)
+	{
+		SIMD_DISPATCH(affine, p, count, a, b)
+	}
+
+	scalar::affine(p, p + count, a, b);
+}
+
+template<typename T>
+inline std::size_t simd::filter(T const* pSrc, std::size_t count, T* pDst, cmp op, T value) noexcept
+{
+	return detail::with_cmp(op, [&](auto op_tag) -> std::size_t
+	{
+		constexpr cmp Op{ decltype(op_tag)::value };
+
+		if constexpr (is_vectorizable_v<T>)
+		{
+			SIMD_DISPATCH(filter<Op>, pSrc, count, pDst, value)
+		}
+
+		return scalar::filter<Op>(pSrc, pSrc + count, pDst, value);
+	});
+}
+
+template<typename T>
+inline T simd::sum(T const* p, std::size_t count) noexcept
+{
+	if constexpr (is_vectorizable_v<T>)
+	{
+		SIMD_DISPATCH(sum, p, count)
+	}
+
+	return scalar::sum(p, p + count, T{});
+}
+
+template<typename T>
+inline T simd::min(T const* p, std::size_t count) noexcept
+{
+	if constexpr (is_vectorizable_v<T>)
+	{
+		SIMD_DISPATCH(min, p, count)
+	}
+
+	return scalar::min(p + 1, p + count, *p);
+}
+
+template<typename T>
+inline T simd::max(T const* p, std::size_t count) noexcept
+{
+	if constexpr (is_vectorizable_v<T>)
+	{
+		SIMD_DISPATCH(max, p, count)
+	}
+
+	return scalar::max(p + 1, p + count, *p);
+}
+
+template<typename T>
+inline std::size_t simd::count(T const* p, std::size_t size, cmp op, T value) noexcept
+{
+	return detail::with_cmp(op, [&](auto op_tag) -> std::size_t
+	{
+		constexpr cmp Op{ decltype(op_tag)::value };
+
+		if constexpr (is_vectorizable_v<T>)
+		{
+			SIMD_DISPATCH(count<Op>, p, size, value)
+		}
+
+		return scalar::count<Op>(p, p + size, value);
+	});
+}
+
+#undef SIMD_DISPATCH
+
+#endif /* __SIMD_HPP_INCLUDED__ */
@@ -0,0 +1,122 @@
+// Kernels shared by every instruction set. Included inside the namespace of one that defines vec<T> for int, float and
+// double with lanes, load, store, set1, add, mul, min, max, compare<Op> (lane mask) and compress_store.
+
+template<typename T>
+void affine(T* p, std::size_t count, T a, T b) noexcept
+{
+	using _V = vec<T>;
+
+	const auto va{ _V::set1(a) };
+	const auto vb{ _V::set1(b) };
+
+	std::size_t i{};
+	for (; i + _V::lanes <= count; i += _V::lanes)
+		_V::store(p + i, _V::add(_V::mul(va, _V::load(p + i)), vb));
+
+	scalar::affine(p + i, p + count, a, b);
+}
+
+template<cmp Op, typename T>
+std::size_t filter(T const* pSrc, std::size_t count, T* pDst, T value) noexcept
+{
+	using _V = vec<T>;
+
+	const auto vval{ _V::set1(value) };
+
+	// compress_store writes a whole vector, which stays within [pDst, pDst + i + lanes) and so never passes unread input
+	std::size_t i{}, kept{};
+	for (; i + _V::lanes <= count; i += _V::lanes)
+	{
+		const auto     v{ _V::load(pSrc + i) };
+		const unsigned mask{ _V::template compare<Op>(v, vval) };
+
+		_V::compress_store(pDst + kept, v, mask);
+		kept += popcount(mask);
+	}
+
+	return kept + scalar::filter<Op>(pSrc + i, pSrc + count, pDst + kept, value);
+}
+
+template<typename T>
+T sum(T const* p, std::size_t count) noexcept
+{
+	using _V = vec<T>;
+
+	if (count < _V::lanes)
+		return scalar::sum(p, p + count, T{});
+
+	auto        acc{ _V::load(p) };
+	std::size_t i{ _V::lanes };
+	for (; i + _V::lanes <= count; i += _V::lanes)
+		acc = _V::add(acc, _V::load(p + i));
+
+	T lanes[_V::lanes];
+	_V::store(lanes, acc);
+
+	return scalar::sum(p + i, p + count, scalar::sum(lanes, lanes + _V::lanes, T{}));
+}
+
+template<typename T>
+T min(T const* p, std::size_t count) noexcept
+{
+	using _V = vec<T>;
+
+	// NaN values are skipped: the accumulator is seeded with a number and stays the second operand, which min instructions
+	// return when a lane is NaN
+	std::size_t i{};
+	while (i < count && scalar::is_nan(p[i]))
+		++i;
+
+	if (i == count)
+		return *p;
+	if (count - i < _V::lanes)
+		return scalar::min(p + i + 1, p + count, p[i]);
+
+	auto acc{ _V::set1(p[i]) };
+	for (; i + _V::lanes <= count; i += _V::lanes)
+		acc = _V::min(_V::load(p + i), acc);
+
+	T lanes[_V::lanes];
+	_V::store(lanes, acc);
+
+	return scalar::min(p + i, p + count, scalar::min(lanes + 1, lanes + _V::lanes, lanes[0]));
+}
+
+template<typename T>
+T max(T const* p, std::size_t count) noexcept
+{
+	using _V = vec<T>;
+
+	// Seeded as in min
+	std::size_t i{};
+	while (i < count && scalar::is_nan(p[i]))
+		++i;
+
+	if (i == count)
+		return *p;
+	if (count - i < _V::lanes)
+		return scalar::max(p + i + 1, p + count, p[i]);
+
+	auto acc{ _V::set1(p[i]) };
+	for (; i + _V::lanes <= count; i += _V::lanes)
+		acc = _V::max(_V::load(p + i), acc);
+
+	T lanes[_V::lanes];
+	_V::store(lanes, acc);
+
+	return scalar::max(p + i, p + count, scalar::max(lanes + 1, lanes + _V::lanes, lanes[0]));
+}
+
+template<cmp Op, typename T>
+std::size_t count(T const* p, std::size_t size, T value) noexcept
+{
+	using _V = vec<T>;
+
+	const auto vval{ _V::set1(value) };
+
+	std::size_t i{}, ret_val{};
+	for (; i + _V::lanes <= size; i += _V::lanes)
+		ret_val += popcount(_V::template compare<Op>(_V::load(p + i), vval));
+
+	return ret_val + scalar::count<Op>(p + i, p + size, value);
+}
@@ -0,0 +1,191 @@
+#pragma once
+
+#ifndef __SOURCE_HPP_INCLUDED__
+#define __SOURCE_HPP_INCLUDED__
+
+#ifndef __cplusplus
+#error
+#error Must use C++ to compile.
+#error
+#endif /* __cplusplus */
+
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <io.h>
+#else
+#include <unistd.h>
+#endif /* _MSC_VER */
+
+#include "Pipeline.hpp"
+#include "Tokenizer.hpp"
+
+inline constexpr std::size_t SOURCE_CHUNK_SIZE = 1 << 20;
+
+// Incremental tokenizer for input arriving in pieces. Data is written straight into buffer() and parsed by commit;
+// a token cut by the end of a piece is moved to the front of the buffer and completed by the next one.
+// The buffer only grows for a token longer than the whole chunk.
+template<typename T>
+class ChunkParser
+{
+public:
+	explicit ChunkParser(std::size_t chunk_size = SOURCE_CHUNK_SIZE, char delim = ' ');
+
+	// Free space for the next piece, never empty
+	[[nodiscard]]
+	std::pair<char*, std::size_t> buffer();
+
+	// Parses n bytes written to buffer() and calls sink for every complete token, n == 0 marks the end of the input
+	template<typename Sink>
+	void commit(std::size_t n, Sink&& sink);
+
+private:
+	std::vector<char> m_buf;
+	std::size_t       m_carry;
+	std::size_t       m_offset; // Of m_buf[0] in the input, for the error positions
+	char              m_delim;
+};
+
+template<typename T>
+inline ChunkParser<T>::ChunkParser(std::size_t chunk_size, char delim) :
+	m_buf(chunk_size ? chunk_size : 1),
+	m_carry(0),
+	m_offset(0),
+	m_delim(delim)
+{ }
+
+template<typename T>
+inline std::pair<char*, std::size_t> ChunkParser<T>::buffer()
+{
+	if (m_carry == m_buf.size())
+		m_buf.resize(m_buf.size() * 2);
+
+	return { m_buf.data() + m_carry, m_buf.size() - m_carry };
+}
+
+template<typename T>
+template<typename Sink>
+void ChunkParser<T>::commit(std::size_t n, Sink&& sink)
+{
+	const Tokenizer delims(std::string_view{}, m_delim);
+
+	const std::size_t filled{ m_carry + n };
+	const bool        eof{ !n };
+
+	// Only the part up to the last delimiter is complete
+	std::size_t end{ filled };
+	if (!eof)
+		while (end && !delims.is_delim(m_buf[end - 1]))
+			--end;
+
+	Tokenizer tokens(std::string_view(m_buf.data(), end), m_delim, m_offset);
+	for (T val{}; tokens.next(val); val = T{})
+		sink(val);
+
+	m_carry = filled - end;
+	std::memmove(m_buf.data(), m_buf.data() + end, m_carry);
+	m_offset += end;
+}
+
+// Reads tokens through a buffer of a fixed size.
+// Read is a callable filling at most n bytes at the pointer and returning how many it wrote, 0 at the end of the input.
+template<typename T, typename Read, typename Sink>
+void read_chunked(Read&& read, Sink&& sink, std::size_t chunk_size = SOURCE_CHUNK_SIZE, char delim = ' ')
+{
+	ChunkParser<T> parser(chunk_size, delim);
+	for (bool eof{}; !eof; )
+	{
+		const auto [pBuf, size] = parser.buffer();
+		const std::size_t n{ read(pBuf, size) };
+		eof = !n;
+
+		parser.commit(n, sink);
+	}
+}
+
+// Pipeline over the tokens of a file, every terminal operation reads it again from the start
+template<typename T>
+[[nodiscard]]
+inline auto make_file_pipeline(std::string path, std::size_t chunk_size = SOURCE_CHUNK_SIZE, char delim = ' ')
+{
+	auto push = [path = std::move(path), chunk_size, delim](auto&& sink)
+	{
+		std::FILE* pFile{};
+#ifdef _MSC_VER
+		if (fopen_s(&pFile, path.c_str(), "rb"))
+			pFile = nullptr;
+#else
+		pFile = std::fopen(path.c_str(), "rb");
+#endif /* _MSC_VER */
+		if (!pFile)
+			throw std::runtime_error("Can't open " + path + ".");
+
+		std::unique_ptr<std::FILE, int(*)(std::FILE*)> file(pFile, &std::fclose);
+		std::setvbuf(pFile, nullptr, _IONBF, 0); // Reads go straight into the chunk buffer
+
+		read_chunked<T>([&](char* pBuf, std::size_t n)
+		{
+			const std::size_t read{ std::fread(pBuf, 1, n, pFile) };
+			if (!read && std::ferror(pFile))
+				throw std::runtime_error("Can't read " + path + ".");
+
+			return read;
+		}, sink, chunk_size, delim);
+	};
+
+	return Pipeline<T, decltype(push)>(std::move(push));
+}
+
+// Pipeline over the tokens read from fd up to its end. The descriptor isn't closed, a second terminal operation
+// continues from where the first one stopped.
+template<typename T>
+[[nodiscard]]
+inline auto make_fd_pipeline(int fd, std::size_t chunk_size = SOURCE_CHUNK_SIZE, char delim = ' ')
+{
+	auto push = [fd, chunk_size, delim](auto&& sink)
+	{
+		read_chunked<T>([fd](char* pBuf, std::size_t n)
+		{
+			for (;;)
+			{
+#ifdef _MSC_VER
+				const int read{ _read(fd, pBuf, static_cast<unsigned>(n > INT_MAX ? INT_MAX : n)) };
+#else
+				const ssize_t read{ ::read(fd, pBuf, n) };
+#endif /* _MSC_VER */
+				if (read >= 0)
+					return static_cast<std::size_t>(read);
+				if (errno != EINTR)
+					throw std::runtime_error("Can't read the file descriptor.");
+			}
+		}, sink, chunk_size, delim);
+	};
+
+	return Pipeline<T, decltype(push)>(std::move(push));
+}
+
+// Pipeline over the tokens of memory which has to outlive it, e.g. a mapped file. Nothing is copied.
+template<typename T>
+[[nodiscard]]
+inline auto make_memory_pipeline(std::string_view region, char delim = ' ')
+{
+	auto push = [region, delim](auto&& sink)
+	{
+		Tokenizer tokens(region, delim);
+		for (T val{}; tokens.next(val); val = T{})
+			sink(val);
+	};
+
+	return Pipeline<T, decltype(push)>(std::move(push));
+}
+
+#endif /* __SOURCE_HPP_INCLUDED__ */
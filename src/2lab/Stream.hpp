@@ -9,7 +9,7 @@
 #error
 #endif /* __cplusplus */
 
-#if (_MSVC_LANG < 201703L)
+#if ((defined(_MSVC_LANG) ? _MSVC_LANG : __cplusplus) < 201703L)
 #error
 #error Must use ISO C++17 Standart
 #error
@@ -17,12 +17,72 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <iostream>
 #include <iomanip>
 #include <functional>
 #include <type_traits>
 #include <sstream>
 #include <charconv>
+#include <typeinfo>
+#include <iterator>
+#include <stdexcept>
+#include <memory>
+#include <utility>
+
+#include "Arena.hpp"
+#include "Async.hpp"
+#include "Channel.hpp"
+#include "ChunkedVector.hpp"
+#include "FlatHashMap.hpp"
+#include "Merge.hpp"
+#include "Pattern.hpp"
+#include "Pipeline.hpp"
+#include "Simd.hpp"
+#include "Source.hpp"
+#include "ThreadPool.hpp"
+#include "Tokenizer.hpp"
+#include "Window.hpp"
+#include "Writer.hpp"
+
+// Container of the same kind holding U, e.g. std::vector<T> -> std::vector<U>
+template<typename Container, typename U>
+struct rebind_container;
+
+template<template<typename, typename> class Container, typename T, typename Alloc, typename U>
+struct rebind_container<Container<T, Alloc>, U>
+{
+	using type = Container<U, typename std::allocator_traits<Alloc>::template rebind_alloc<U>>;
+};
+
+template<typename Container, typename U>
+using rebind_container_t = typename rebind_container<Container, U>::type;
+
+template<typename Container, typename = void>
+struct has_reserve : std::false_type { };
+
+template<typename Container>
+struct has_reserve<Container, std::void_t<decltype(std::declval<Container&>().reserve(0))>> : std::true_type { };
+
+template<typename Container, typename = void>
+struct has_segments : std::false_type { };
+
+// Container stored in contiguous blocks it can hand out as pointer ranges, e.g. ChunkedVector
+template<typename Container>
+struct has_segments<Container, std::void_t<decltype(std::declval<Container&>().for_each_segment(std::declval<void(*)(typename Container::value_type*, typename Container::value_type*)>()))>> : std::true_type { };
+
+template<typename Container, typename = void>
+struct has_pop_front : std::false_type { };
+
+template<typename Container>
+struct has_pop_front<Container, std::void_t<decltype(std::declval<Container&>().pop_front())>> : std::true_type { };
+
+// tree puts every element on its own line with its index, flat puts all of them on one line
+enum class DumpLayout
+{
+	tree,
+	flat
+};
 
 template<typename T, typename Container = std::vector<T>>
 class Stream
@@ -31,19 +91,95 @@ class Stream
 	using _Cont = Container;
 	using _Iter = typename _Cont::iterator;
 	using _Const_Iter = typename _Cont::const_iterator;
-	using _map_func_t = std::function<_T(_T&)>;
-	using _where_func_t = std::function<bool(_T&)>;
-	using _reduce_func_t = std::function<_T(_T&, _T&)>;
+
+	template<typename F>
+	using _map_result_t = std::decay_t<std::invoke_result_t<F&, _T&>>;
+
+	template<typename F>
+	using _key_t = std::decay_t<std::invoke_result_t<F&, _T const&>>;
+
+	template<typename Policy, typename R = void>
+	using _enable_if_policy_t = std::enable_if_t<execution::is_execution_policy_v<Policy>, R>;
+
+	static constexpr bool _random_access = std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<_Iter>::iterator_category>;
+
+	// Stream<std::string_view> keeps the text its elements view in an arena shared with the streams mapped from it
+	static constexpr bool _string_view = std::is_same_v<_T, std::string_view>;
+
+	struct _Text_storage
+	{
+		std::shared_ptr<StringArena>              pArena;
+		std::vector<std::shared_ptr<StringArena>> adopted; // Arenas of the streams merged into this one
+		bool                                      interning{};
+	};
+
+	struct _No_text_storage { };
+
+	using _Text = std::conditional_t<_string_view, _Text_storage, _No_text_storage>;
+
+	// Elements lie in one array, so the vectorized kernels can run over them
+	static constexpr bool _contiguous = std::is_same_v<_Cont, std::vector<_T, typename _Cont::allocator_type>> && !std::is_same_v<_T, bool>;
+
+	// Elements lie in one or more arrays
+	static constexpr bool _segmented = _contiguous || has_segments<_Cont>::value;
+
+	// Smallest amount of elements worth handing to another thread
+	static constexpr std::size_t _min_chunk = 4096;
+
+	// Consumed elements kept in front of the buffer before it is compacted
+	static constexpr std::size_t _min_compact = 64;
+
+	template<typename U, typename Cont>
+	friend class Stream;
 
 private:
 	void parse(std::string_view str);
 
+	// Drops the elements already taken by operator>> and pop_n
+	void compact();
+
+	// Copies str to the arena, or finds its interned copy
+	[[nodiscard]]
+	std::string_view store(std::string_view str);
+
+	[[nodiscard]]
+	static std::size_t chunk_count(std::size_t size) noexcept;
+
+	// Splits [0, size) into nChunks contiguous chunks and calls func(chunk, first, last) for each of them on the shared pool
+	template<typename F>
+	static void for_chunks(std::size_t nChunks, std::size_t size, F&& func);
+
+	// Calls func(first, last) for every contiguous part of the elements in order, pointers for segmented containers and
+	// iterators over the whole stream otherwise
+	template<typename F>
+	void for_each_segment(F&& func);
+
+	template<typename F>
+	void for_each_segment(F&& func) const;
+
+	// Writer formats _T exactly as rOstr would
+	[[nodiscard]]
+	static bool writer_matches(std::ostream& rOstr);
+
 public:
 	Stream() noexcept = default;
 	Stream(std::string const&);
 	Stream(std::initializer_list<_T>);
+	explicit Stream(_Cont&& rrCont) noexcept;
 	Stream(Stream const&) = delete;
-	Stream(Stream&&) = delete;
+	Stream(Stream&& rrStream) noexcept;
+
+#ifdef STREAM_COROUTINES
+	// Stores everything the generator yields
+	explicit Stream(Generator<_T> gen);
+#endif /* STREAM_COROUTINES */
+
+	// Stream<std::string_view> whose elements point into str, which has to outlive it. Nothing is copied.
+	[[nodiscard]]
+	static Stream borrow(std::string_view str);
+
+	// Stream<std::string_view> only: strings parsed or mapped from now on are stored once per distinct value
+	Stream& interning(bool enable = true);
 
 	[[nodiscard]]
 	inline _Iter begin() noexcept;
@@ -59,12 +195,87 @@ public:
 
 	inline void clear() noexcept;
 
-	void map(_map_func_t map_func);
+	[[nodiscard]]
+	inline std::size_t size() const noexcept;
+
+	[[nodiscard]]
+	inline bool empty() const noexcept;
+
+	// Moves up to count elements from the front to pDst, returns how many were moved
+	std::size_t pop_n(_T* pDst, std::size_t count);
+
+	[[nodiscard]]
+	auto lazy() noexcept;
+
+	// In place if F returns _T, otherwise returns new Stream<U>.
+	// Stream<std::string_view> stores std::string results in its arena and stays in place as well.
+	template<typename F>
+	decltype(auto) map(F&& map_func);
+
+	// Parallel policies call map_func concurrently
+	template<typename Policy, typename F, typename = _enable_if_policy_t<Policy>>
+	decltype(auto) map(Policy&& policy, F&& map_func);
+
+	template<typename F>
+	void where(F&& where_func);
+
+	// Keeps the order of the elements
+	template<typename Policy, typename F, typename = _enable_if_policy_t<Policy>>
+	void where(Policy&& policy, F&& where_func);
+
+	template<typename F>
+	[[nodiscard]]
+	_T reduce(F&& reduce_func, _T init_val);
+
+	// Parallel policies require reduce_func to be associative
+	template<typename Policy, typename F, typename = _enable_if_policy_t<Policy>>
+	[[nodiscard]]
+	_T reduce(Policy&& policy, F&& reduce_func, _T init_val);
+
+	// x = a * x + b, integers wrap around. Vectorized for int, float and double.
+	Stream& affine(_T a, _T b);
+
+	// Keeps the elements for which `x op value` holds
+	void where(simd::cmp op, _T value);
+
+	// Floating point elements are summed lane by lane, so the result may differ from reduce in the last bits
+	[[nodiscard]]
+	_T sum() const;
+
+	// Throw std::out_of_range on an empty stream. NaN elements are skipped, the result is NaN only if every element is.
+	[[nodiscard]]
+	_T min() const;
+
+	[[nodiscard]]
+	_T max() const;
+
+	[[nodiscard]]
+	std::size_t count(simd::cmp op, _T value) const;
+
+	// Aggregates of every width consecutive elements in O(1) amortized per element, reduce_func has to be associative
+	template<typename F>
+	[[nodiscard]]
+	Stream sliding(std::size_t width, F&& reduce_func) const;
+
+	// Same for reduce_func which inverse_func(x, acc) undoes: the element leaving the window is taken out of acc
+	template<typename F, typename Inverse>
+	[[nodiscard]]
+	Stream sliding(std::size_t width, F&& reduce_func, Inverse&& inverse_func) const;
+
+	// Aggregates of consecutive windows of width elements, the last one may be shorter
+	template<typename F>
+	[[nodiscard]]
+	Stream tumbling(std::size_t width, F&& reduce_func) const;
 
-	void where(_where_func_t where_func);
+	// reduce for every key_func(x) in one pass, the keys are in the order they first appear
+	template<typename Key, typename F>
+	[[nodiscard]]
+	FlatHashMap<_key_t<Key>, _T> reduce_by_key(Key&& key_func, F&& reduce_func, _T init_val) const;
 
+	// Moves the elements to the streams of their key_func(x) keeping their order and leaves this one empty
+	template<typename Key>
 	[[nodiscard]]
-	_T reduce(_reduce_func_t reduce_func, _T init_val);
+	FlatHashMap<_key_t<Key>, Stream> group_by(Key&& key_func);
 
 	[[nodiscard]]
 	inline _Cont get_subseq(_Iter first, _Iter last) const;
@@ -72,46 +283,153 @@ public:
 	[[nodiscard]]
 	std::pair<bool, _Const_Iter> find_subseq(std::string const& crPattern) const;
 
-	void merge();
+	[[nodiscard]]
+	std::pair<bool, _Const_Iter> find_subseq(Pattern<_T> const& crPattern) const;
+
+	template<typename Policy, typename = _enable_if_policy_t<Policy>>
+	[[nodiscard]]
+	std::pair<bool, _Const_Iter> find_subseq(Policy&& policy, std::string const& crPattern) const;
+
+	template<typename Policy, typename = _enable_if_policy_t<Policy>>
+	[[nodiscard]]
+	std::pair<bool, _Const_Iter> find_subseq(Policy&& policy, Pattern<_T> const& crPattern) const;
+
+	// Positions of all the matches, overlapping ones included
+	[[nodiscard]]
+	std::vector<std::size_t> find_all(Pattern<_T> const& crPattern) const;
+
+	[[nodiscard]]
+	std::size_t count(Pattern<_T> const& crPattern) const;
+
+	// Moves the elements of the sorted streams into this sorted one and leaves them empty.
+	// Equal elements keep the order of the streams, the ones of this stream first.
+	template<typename Compare = std::less<>>
+	Stream& merge(std::vector<std::reference_wrapper<Stream>> const& crStreams, Compare comp = Compare());
+
+	// Parallel policies split large merges into independent parts
+	template<typename Policy, typename Compare = std::less<>, typename = _enable_if_policy_t<Policy>>
+	Stream& merge(Policy&& policy, std::vector<std::reference_wrapper<Stream>> const& crStreams, Compare comp = Compare());
+
+	// Moves every element to the stream number key_func(x) out of nStreams keeping their order and leaves this one empty.
+	// A predicate sends the elements it rejects to the first stream and the rest to the second.
+	template<typename F>
+	[[nodiscard]]
+	std::vector<Stream> separate(std::size_t nStreams, F&& key_func);
+
+	void dump(std::ostream& = std::cout, DumpLayout layout = DumpLayout::tree) const noexcept;
+
+	// Bulk output: elements separated by delim and a final '\n', formatted with to_chars into a large buffer.
+	// Floating point values take the shortest form that reads back exactly.
+	void write(Writer& rWriter, char delim = ' ') const;
 
-	void separate();
+	void write(std::ostream& rOstr, char delim = ' ') const;
 
-	void dump(std::ostream& = std::cout) const noexcept;
+	void write(int fd, char delim = ' ') const;
 
 	Stream& operator<<(std::string const& crString);
+
+	// Takes the front element in amortized O(1), throws std::out_of_range on an empty stream
 	Stream& operator>>(_T& rVal);
 
 	Stream& operator=(std::initializer_list<_T>);
 	Stream& operator=(Stream const&) = delete;
-	Stream& operator=(Stream&&)      = delete;
+	Stream& operator=(Stream&& rrStream) noexcept;
 
-	template<typename T, typename Cont>
-	friend std::istream& operator>>(std::istream& rIstr, Stream<T, Cont> const& crStream);
+	template<typename U, typename Cont>
+	friend std::istream& operator>>(std::istream& rIstr, Stream<U, Cont>& rStream);
 
-	template<typename T, typename Cont>
-	friend std::ostream& operator<<(std::ostream& rOstr, Stream<T, Cont> const& crStream);
+	template<typename U, typename Cont>
+	friend std::ostream& operator<<(std::ostream& rOstr, Stream<U, Cont> const& crStream);
 
 private:
-	_Cont m_buf;
+	_Cont       m_buf;
+	std::size_t m_head{}; // Consumed elements at the front of m_buf, always 0 for containers with pop_front
+	_Text       m_text;   // Views handed out stay valid while the stream or a stream sharing the arena lives
 };
 
 template<typename T, typename Container>
 inline void Stream<T, Container>::parse(std::string_view str)
 {
-	std::stringstream ss(std::string(str) += '\n');
-	_T tmp{};                                              
-	while (ss.good())                                        
-	{     
-		ss >> tmp;                                           
-		if (ss.good())
+	if constexpr (_string_view)
+	{
+		// Without interning the whole input is copied at once and the tokens point into the copy
+		Tokenizer tokens(m_text.interning ? str : store(str));
+		for (std::string_view token; tokens.next(token); )
+			m_buf.push_back(m_text.interning ? store(token) : token);
+	}
+	else
+	{
+		Tokenizer tokens(str);
+		for (_T tmp{}; tokens.next(tmp); tmp = _T{})
 			m_buf.push_back(std::move(tmp));
-		else if (ss.eof())
-			break;
-		else
-			throw std::runtime_error("Wrong input.");
 	}
 }
 
+template<typename T, typename Container>
+inline std::string_view Stream<T, Container>::store(std::string_view str)
+{
+	static_assert(_string_view, "Only Stream<std::string_view> has an arena.");
+
+	if (!m_text.pArena)
+		m_text.pArena = std::make_shared<StringArena>();
+
+	return (m_text.interning ? m_text.pArena->intern(str) : m_text.pArena->store(str));
+}
+
+template<typename T, typename Container>
+inline void Stream<T, Container>::compact()
+{
+	if (!m_head)
+		return;
+
+	m_buf.erase(std::begin(m_buf), std::next(std::begin(m_buf), m_head));
+	m_head = 0;
+}
+
+template<typename T, typename Container>
+template<typename F>
+inline void Stream<T, Container>::for_each_segment(F&& func)
+{
+	if constexpr (has_segments<_Cont>::value)
+		m_buf.for_each_segment(func);
+	else if constexpr (_contiguous)
+		func(m_buf.data() + m_head, m_buf.data() + std::size(m_buf));
+	else
+		func(begin(), end());
+}
+
+template<typename T, typename Container>
+template<typename F>
+inline void Stream<T, Container>::for_each_segment(F&& func) const
+{
+	if constexpr (has_segments<_Cont>::value)
+		m_buf.for_each_segment(func);
+	else if constexpr (_contiguous)
+		func(m_buf.data() + m_head, m_buf.data() + std::size(m_buf));
+	else
+		func(cbegin(), cend());
+}
+
+template<typename T, typename Container>
+inline std::size_t Stream<T, Container>::chunk_count(std::size_t size) noexcept
+{
+	// A few chunks per thread so that stealing can even out uneven ones
+	const std::size_t max_chunks{ ThreadPool::instance().size() * 4 };
+	const std::size_t nChunks{ size / _min_chunk };
+
+	return (nChunks < 1 ? 1 : nChunks > max_chunks ? max_chunks : nChunks);
+}
+
+template<typename T, typename Container>
+template<typename F>
+inline void Stream<T, Container>::for_chunks(std::size_t nChunks, std::size_t size, F&& func)
+{
+	ThreadPool::instance().parallel_for(nChunks, [&](std::size_t chunk)
+	{
+		func(chunk, size * chunk / nChunks, size * (chunk + 1) / nChunks);
+	});
+}
+
 template<typename T, typename Container>
 inline Stream<T, Container>::Stream(std::string const& crString) :
 	m_buf()
@@ -125,210 +443,1041 @@ inline Stream<T, Container>::Stream(std::initializer_list<_T> list) :
 { }
 
 template<typename T, typename Container>
-inline typename Stream<T, Container>::_Iter Stream<T, Container>::begin() noexcept
+inline Stream<T, Container>::Stream(_Cont&& rrCont) noexcept :
+	m_buf(std::move(rrCont))
+{ }
+
+template<typename T, typename Container>
+inline Stream<T, Container>::Stream(Stream&& rrStream) noexcept :
+	m_buf(std::move(rrStream.m_buf)),
+	m_head(std::exchange(rrStream.m_head, 0)),
+	m_text(std::move(rrStream.m_text))
 {
-	return std::begin(m_buf);
+	rrStream.m_buf.clear();
 }
 
+#ifdef STREAM_COROUTINES
 template<typename T, typename Container>
-inline typename Stream<T, Container>::_Const_Iter Stream<T, Container>::cbegin() const noexcept
+inline Stream<T, Container>::Stream(Generator<_T> gen) :
+	m_buf()
 {
-	return std::cbegin(m_buf);
+	for (auto const& crVal : gen)
+		m_buf.push_back(crVal);
 }
+#endif /* STREAM_COROUTINES */
 
 template<typename T, typename Container>
-inline typename Stream<T, Container>::_Iter Stream<T, Container>::end() noexcept
+inline Stream<T, Container> Stream<T, Container>::borrow(std::string_view str)
 {
-	return std::end(m_buf);
+	static_assert(_string_view, "Only Stream<std::string_view> can borrow its input.");
+
+	Stream ret_val;
+
+	Tokenizer tokens(str);
+	for (std::string_view token; tokens.next(token); )
+		ret_val.m_buf.push_back(token);
+
+	return ret_val;
 }
 
 template<typename T, typename Container>
-inline void Stream<T, Container>::clear() noexcept
+inline Stream<T, Container>& Stream<T, Container>::interning(bool enable)
 {
-	m_buf.clear(); 
+	static_assert(_string_view, "Only Stream<std::string_view> has an arena.");
+
+	m_text.interning = enable;
+
+	return (*this);
 }
 
 template<typename T, typename Container>
-inline typename Stream<T, Container>::_Const_Iter Stream<T, Container>::cend() const noexcept
+inline typename Stream<T, Container>::_Iter Stream<T, Container>::begin() noexcept
 {
-	return std::cend(m_buf);
+	return std::next(std::begin(m_buf), m_head);
 }
 
 template<typename T, typename Container>
-void Stream<T, Container>::map(_map_func_t map_func)
+inline typename Stream<T, Container>::_Const_Iter Stream<T, Container>::cbegin() const noexcept
 {
-	for (auto& val : m_buf)
-		val = map_func(val);
+	return std::next(std::cbegin(m_buf), m_head);
 }
 
 template<typename T, typename Container>
-void Stream<T, Container>::where(_where_func_t where_func)
+inline typename Stream<T, Container>::_Iter Stream<T, Container>::end() noexcept
 {
-	_Cont cont;
-	cont.reserve(m_buf.size());
-
-	for (auto it{ std::begin(m_buf) }; it != std::end(m_buf); ++it)
-		if (where_func(*it))
-			cont.push_back(*it);
+	return std::end(m_buf);
+}
 
-	cont.shrink_to_fit();
+template<typename T, typename Container>
+inline void Stream<T, Container>::clear() noexcept
+{
+	m_buf.clear();
+	m_head = 0;
+}
 
-	using std::swap; // Enable all swaps
-	swap(m_buf, cont);
+template<typename T, typename Container>
+inline std::size_t Stream<T, Container>::size() const noexcept
+{
+	return std::size(m_buf) - m_head;
 }
 
 template<typename T, typename Container>
-typename Stream<T, Container>::_T Stream<T, Container>::reduce(_reduce_func_t reduce_func, _T init_val)
+inline bool Stream<T, Container>::empty() const noexcept
 {
-	_T ret_val{ init_val };
-	for (auto&& x : m_buf)
-		ret_val = reduce_func(x, ret_val);
+	return (size() == 0);
+}
 
-	return ret_val;
+template<typename T, typename Container>
+inline typename Stream<T, Container>::_Const_Iter Stream<T, Container>::cend() const noexcept
+{
+	return std::cend(m_buf);
 }
 
 template<typename T, typename Container>
-inline typename Stream<T, Container>::_Cont Stream<T, Container>::get_subseq(_Iter first, _Iter last) const
+inline auto Stream<T, Container>::lazy() noexcept
 {
-	return _Cont(first, last);
+	auto push = [this](auto&& sink)
+	{
+		for (auto it{ begin() }; it != end(); ++it)
+			sink(*it);
+	};
+
+	return Pipeline<_T, decltype(push)>(std::move(push));
 }
 
 template<typename T, typename Container>
-inline std::pair<bool, typename Stream<T, Container>::_Const_Iter> Stream<T, Container>::find_subseq(std::string const& crPattern) const
+template<typename F>
+decltype(auto) Stream<T, Container>::map(F&& map_func)
 {
-	if (crPattern.empty())
-		throw std::runtime_error("Wrong pattern.");
+	compact();
+
+	using _U = _map_result_t<F>;
 
-	std::stringstream             ss(crPattern);
-	std::vector<std::string> vec;
-	while (!ss.eof())
+	if constexpr (std::is_same_v<_U, _T>)
 	{
-		std::string tmp;
-		ss >> tmp;
+		for_each_segment([&](auto first, auto last)
+		{
+			for (; first != last; ++first)
+				*first = std::invoke(map_func, *first);
+		});
 
-		vec.push_back(tmp);
+		return (*this);
 	}
+	else if constexpr (_string_view && std::is_same_v<_U, std::string>)
+	{
+		for (auto& val : m_buf)
+			val = store(std::invoke(map_func, val));
 
-	auto                              size{ vec.size() };
-	typename decltype(vec)::size_type j{};
-	for (auto it{ std::begin(m_buf) }, cur{ it }; it != std::cend(m_buf); ++it)
+		return (*this);
+	}
+	else
 	{
-		if (!j)
-			cur = it;
+		rebind_container_t<_Cont, _U> cont;
+		if constexpr (has_reserve<decltype(cont)>::value)
+			cont.reserve(std::size(m_buf));
 
-		if constexpr (std::is_arithmetic_v<_T>)
+		for_each_segment([&](auto first, auto last)
 		{
-			char buf[sizeof(_T)]{};
-			if (auto [ptr, ec] = std::to_chars(std::begin(buf), std::end(buf), *it); ec == std::errc() && std::string_view(buf, ptr - buf) == vec[j])
-				if (j + 1 == size)
-					return { true, cur };
-				else
-					j++;
-			else
-				j = 0ULL;
-		}
-		else // Assuming _T == std::string
+			for (; first != last; ++first)
+				cont.push_back(std::invoke(map_func, *first));
+		});
+
+		return Stream<_U, rebind_container_t<_Cont, _U>>(std::move(cont));
+	}
+}
+
+template<typename T, typename Container>
+template<typename Policy, typename F, typename>
+decltype(auto) Stream<T, Container>::map(Policy&&, F&& map_func)
+{
+	compact();
+
+	using _U = _map_result_t<F>;
+	using _UCont = rebind_container_t<_Cont, _U>;
+
+	// The arena isn't shared between threads
+	if constexpr (!execution::is_parallel_policy_v<Policy> || !_random_access || (_string_view && std::is_same_v<_U, std::string>))
+		return map(std::forward<F>(map_func));
+	else if constexpr (std::is_same_v<_U, _T>)
+	{
+		const std::size_t size{ std::size(m_buf) };
+		for_chunks(chunk_count(size), size, [&](std::size_t, std::size_t first, std::size_t last)
 		{
-			if (*it == vec[j])
-				if (j + 1 == size)
-					return { true, cur };
-				else
-					j++;
-			else
-				j = 0ULL;
-		}
+			for (auto it{ std::begin(m_buf) + first }, end{ std::begin(m_buf) + last }; it != end; ++it)
+				*it = std::invoke(map_func, *it);
+		});
+
+		return (*this);
 	}
+	else if constexpr (!std::is_default_constructible_v<_U>)
+		return map(std::forward<F>(map_func));
+	else
+	{
+		const std::size_t size{ std::size(m_buf) };
+		_UCont            cont(size);
+		for_chunks(chunk_count(size), size, [&](std::size_t, std::size_t first, std::size_t last)
+		{
+			auto out{ std::begin(cont) + first };
+			for (auto it{ std::begin(m_buf) + first }, end{ std::begin(m_buf) + last }; it != end; ++it, ++out)
+				*out = std::invoke(map_func, *it);
+		});
 
-	return { false, std::cend(m_buf) };
+		return Stream<_U, _UCont>(std::move(cont));
+	}
 }
 
 template<typename T, typename Container>
-void Stream<T, Container>::dump(std::ostream &rOstr) const noexcept
+template<typename F>
+void Stream<T, Container>::where(F&& where_func)
 {
-	try
-	{
-		rOstr << "\t[STREAM DUMP]\nStream<" << typeid(_T).name() << ", " << typeid(_Cont).name() << "> [0x" << this << "]\n"
-			<< "{\n\t buffer [" << std::size(m_buf) << "] = 0x" << &m_buf << "\n\t{\n";
+	compact();
 
-		if (std::size(m_buf))
-			for (auto it{ std::cbegin(m_buf) }; it != std::cend(m_buf); ++it)
+	// Survivors are moved forward in place, nothing is allocated
+	auto out{ std::begin(m_buf) };
+	for_each_segment([&](auto first, auto last)
+	{
+		for (; first != last; ++first)
+			if (std::invoke(where_func, *first))
 			{
-				rOstr << "\t\t[" << std::distance(std::begin(m_buf), it) << "] = ";
+				bool in_place;
+				if constexpr (std::is_pointer_v<decltype(first)>)
+					in_place = (std::addressof(*out) == first);
+				else
+					in_place = (out == first);
 
-				if (std::is_arithmetic_v<_T>)
-					rOstr << std::setw(sizeof(_T));
+				if (!in_place)
+					*out = std::move(*first);
 
-				rOstr << *it << std::endl;
+				++out;
 			}
-		else
-			rOstr << "\t\tempty\n";
+	});
 
-		rOstr << "\t}\n}\n";
-	}
-	catch (std::exception const& crException)
-	{
-		std::cerr << "[ERROR] " << crException.what() << std::endl;
+	m_buf.erase(out, std::end(m_buf));
+}
 
-		std::terminate();
-	}
-	catch (...)
+template<typename T, typename Container>
+template<typename Policy, typename F, typename>
+void Stream<T, Container>::where(Policy&&, F&& where_func)
+{
+	compact();
+
+	if constexpr (!execution::is_parallel_policy_v<Policy> || !_random_access || !std::is_default_constructible_v<_T>)
+		where(std::forward<F>(where_func));
+	else
 	{
-		std::cerr << "[FATAL] Unknown error." << std::endl;
+		const std::size_t size{ std::size(m_buf) };
+		const std::size_t nChunks{ chunk_count(size) };
 
-		std::terminate();
+		// Every chunk marks the elements it keeps and counts them
+		std::vector<unsigned char> keep(size);
+		std::vector<std::size_t>   offsets(nChunks + 1);
+		for_chunks(nChunks, size, [&](std::size_t chunk, std::size_t first, std::size_t last)
+		{
+			std::size_t count{};
+			for (auto i{ first }; i < last; ++i)
+				count += (keep[i] = static_cast<unsigned char>(std::invoke(where_func, m_buf[i]) ? 1 : 0));
+
+			offsets[chunk + 1] = count;
+		});
+
+		// Exclusive prefix sum gives each chunk its place in the result
+		for (std::size_t chunk{}; chunk < nChunks; ++chunk)
+			offsets[chunk + 1] += offsets[chunk];
+
+		_Cont cont(offsets[nChunks]);
+		for_chunks(nChunks, size, [&](std::size_t chunk, std::size_t first, std::size_t last)
+		{
+			auto out{ std::begin(cont) + offsets[chunk] };
+			for (auto i{ first }; i < last; ++i)
+				if (keep[i])
+					*out++ = std::move(m_buf[i]);
+		});
+
+		using std::swap; // Enable all swaps
+		swap(m_buf, cont);
 	}
 }
 
-template<typename T, typename Cont>
-Stream<T, Cont>& Stream<T, Cont>::operator<<(std::string const& crString)
+template<typename T, typename Container>
+template<typename F>
+typename Stream<T, Container>::_T Stream<T, Container>::reduce(F&& reduce_func, _T init_val)
 {
-	parse(crString);
+	compact();
 
-	return (*this);
+	_T ret_val{ std::move(init_val) };
+	for_each_segment([&](auto first, auto last)
+	{
+		for (; first != last; ++first)
+			ret_val = std::invoke(reduce_func, *first, ret_val);
+	});
+
+	return ret_val;
 }
 
 template<typename T, typename Container>
-inline Stream<T, Container>& Stream<T, Container>::operator>>(_T& rVal)
+template<typename Policy, typename F, typename>
+typename Stream<T, Container>::_T Stream<T, Container>::reduce(Policy&&, F&& reduce_func, _T init_val)
 {
-	rVal = *begin(m_buf);
+	compact();
+
+	if constexpr (!execution::is_parallel_policy_v<Policy> || !_random_access)
+		return reduce(std::forward<F>(reduce_func), std::move(init_val));
+	else
+	{
+		const std::size_t size{ std::size(m_buf) };
+		if (!size)
+			return init_val;
+
+		// Every chunk folds onto its first element; the partials are combined in order, which is where associativity is needed
+		const std::size_t nChunks{ chunk_count(size) };
+		std::vector<_T>   partials(nChunks, init_val);
+		for_chunks(nChunks, size, [&](std::size_t chunk, std::size_t first, std::size_t last)
+		{
+			_T partial{ m_buf[first] };
+			for (auto i{ first + 1 }; i < last; ++i)
+				partial = std::invoke(reduce_func, m_buf[i], partial);
 
-	m_buf.erase(cbegin(m_buf));
+			partials[chunk] = std::move(partial);
+		});
 
-	return (*this);
+		_T ret_val{ std::move(init_val) };
+		for (auto&& partial : partials)
+			ret_val = std::invoke(reduce_func, partial, ret_val);
+
+		return ret_val;
+	}
 }
 
 template<typename T, typename Container>
-inline Stream<T, Container>& Stream<T, Container>::operator=(std::initializer_list<_T> list)
+Stream<T, Container>& Stream<T, Container>::affine(_T a, _T b)
 {
-	using std::swap; // Enable all swaps
-	swap(m_buf, _Cont(list.begin(), list.end()));
+	if constexpr (_segmented)
+		for_each_segment([&](_T* first, _T* last) { simd::affine(first, static_cast<std::size_t>(last - first), a, b); });
+	else
+		simd::scalar::affine(begin(), end(), a, b);
 
 	return (*this);
 }
 
-template<typename T, typename Cont>
-std::istream& operator>>(std::istream &rIstr, Stream<T, Cont> const& crStream)
+template<typename T, typename Container>
+void Stream<T, Container>::where(simd::cmp op, _T value)
 {
-	std::string str;
-	std::getline(rIstr, str, '\n');
-
-	crStream << str;
+	compact();
 
-	return rIstr;
+	if constexpr (_contiguous)
+		m_buf.resize(simd::filter(m_buf.data(), m_buf.size(), m_buf.data(), op, value));
+	else
+		where([op, &value](_T const& crVal) { return simd::compare(op, crVal, value); });
 }
 
-template<typename T, typename Cont>
-std::ostream& operator<<(std::ostream &rOstr, Stream<T, Cont> const& crStream)
+template<typename T, typename Container>
+typename Stream<T, Container>::_T Stream<T, Container>::sum() const
 {
-	if (std::size(crStream.m_buf))
-		for (auto&& val : crStream.m_buf)
-			rOstr << val << " ";
+	if constexpr (_segmented)
+	{
+		_T ret_val{};
+		for_each_segment([&](_T const* first, _T const* last) { ret_val = simd::scalar::add(ret_val, simd::sum(first, static_cast<std::size_t>(last - first))); });
+
+		return ret_val;
+	}
 	else
-		rOstr << "empty";
+		return simd::scalar::sum(cbegin(), cend(), _T{});
+}
 
-	rOstr << std::endl;
+template<typename T, typename Container>
+typename Stream<T, Container>::_T Stream<T, Container>::min() const
+{
+	if (empty())
+		throw std::out_of_range("Stream is empty.");
 
-	return rOstr;
+	if constexpr (_segmented)
+	{
+		_T ret_val{ *cbegin() };
+		for_each_segment([&](_T const* first, _T const* last)
+		{
+			const _T val{ simd::min(first, static_cast<std::size_t>(last - first)) };
+			ret_val = simd::scalar::min(&val, &val + 1, ret_val);
+		});
+
+		return ret_val;
+	}
+	else
+		return simd::scalar::min(std::next(cbegin()), cend(), *cbegin());
+}
+
+template<typename T, typename Container>
+typename Stream<T, Container>::_T Stream<T, Container>::max() const
+{
+	if (empty())
+		throw std::out_of_range("Stream is empty.");
+
+	if constexpr (_segmented)
+	{
+		_T ret_val{ *cbegin() };
+		for_each_segment([&](_T const* first, _T const* last)
+		{
+			const _T val{ simd::max(first, static_cast<std::size_t>(last - first)) };
+			ret_val = simd::scalar::max(&val, &val + 1, ret_val);
+		});
+
+		return ret_val;
+	}
+	else
+		return simd::scalar::max(std::next(cbegin()), cend(), *cbegin());
+}
+
+template<typename T, typename Container>
+std::size_t Stream<T, Container>::count(simd::cmp op, _T value) const
+{
+	if constexpr (_segmented)
+	{
+		std::size_t ret_val{};
+		for_each_segment([&](_T const* first, _T const* last) { ret_val += simd::count(first, static_cast<std::size_t>(last - first), op, value); });
+
+		return ret_val;
+	}
+	else
+		return simd::detail::with_cmp(op, [&](auto op_tag) { return simd::scalar::count<decltype(op_tag)::value>(cbegin(), cend(), value); });
+}
+
+template<typename T, typename Container>
+template<typename F>
+Stream<T, Container> Stream<T, Container>::sliding(std::size_t width, F&& reduce_func) const
+{
+	if (!width)
+		throw std::runtime_error("Wrong window width.");
+
+	Stream ret_val;
+	ret_val.m_text = m_text;
+	if constexpr (has_reserve<_Cont>::value)
+		ret_val.m_buf.reserve(size() < width ? 0 : size() - width + 1);
+
+	SlidingWindow<_T, std::reference_wrapper<std::remove_reference_t<F>>> window(std::ref(reduce_func));
+	for (auto it{ cbegin() }; it != cend(); ++it)
+	{
+		window.push(*it);
+		if (window.size() > width)
+			window.pop();
+		if (window.size() == width)
+			ret_val.m_buf.push_back(window.value());
+	}
+
+	return ret_val;
+}
+
+template<typename T, typename Container>
+template<typename F, typename Inverse>
+Stream<T, Container> Stream<T, Container>::sliding(std::size_t width, F&& reduce_func, Inverse&& inverse_func) const
+{
+	if (!width)
+		throw std::runtime_error("Wrong window width.");
+
+	Stream ret_val;
+	ret_val.m_text = m_text;
+	if (size() < width)
+		return ret_val;
+
+	if constexpr (has_reserve<_Cont>::value)
+		ret_val.m_buf.reserve(size() - width + 1);
+
+	// Two iterators walk the stream width elements apart, the leading one adds and the trailing one takes out
+	auto it{ cbegin() };
+	_T   acc{ *it++ };
+	for (std::size_t i{ 1 }; i < width; ++i, ++it)
+		acc = std::invoke(reduce_func, *it, acc);
+
+	ret_val.m_buf.push_back(acc);
+	for (auto old{ cbegin() }; it != cend(); ++it, ++old)
+	{
+		acc = std::invoke(reduce_func, *it, std::invoke(inverse_func, *old, acc));
+		ret_val.m_buf.push_back(acc);
+	}
+
+	return ret_val;
+}
+
+template<typename T, typename Container>
+template<typename F>
+Stream<T, Container> Stream<T, Container>::tumbling(std::size_t width, F&& reduce_func) const
+{
+	if (!width)
+		throw std::runtime_error("Wrong window width.");
+
+	Stream ret_val;
+	ret_val.m_text = m_text;
+	if constexpr (has_reserve<_Cont>::value)
+		ret_val.m_buf.reserve((size() + width - 1) / width);
+
+	for (auto it{ cbegin() }; it != cend(); )
+	{
+		_T acc{ *it++ };
+		for (std::size_t i{ 1 }; i < width && it != cend(); ++i, ++it)
+			acc = std::invoke(reduce_func, *it, acc);
+
+		ret_val.m_buf.push_back(std::move(acc));
+	}
+
+	return ret_val;
+}
+
+template<typename T, typename Container>
+template<typename Key, typename F>
+FlatHashMap<typename Stream<T, Container>::template _key_t<Key>, T> Stream<T, Container>::reduce_by_key(Key&& key_func, F&& reduce_func, _T init_val) const
+{
+	FlatHashMap<_key_t<Key>, _T> ret_val;
+	for (auto it{ cbegin() }; it != cend(); ++it)
+	{
+		_T& rAcc{ ret_val.try_emplace(std::invoke(key_func, *it), init_val).first->second };
+		rAcc = std::invoke(reduce_func, *it, rAcc);
+	}
+
+	return ret_val;
+}
+
+template<typename T, typename Container>
+template<typename Key>
+FlatHashMap<typename Stream<T, Container>::template _key_t<Key>, Stream<T, Container>> Stream<T, Container>::group_by(Key&& key_func)
+{
+	compact();
+
+	FlatHashMap<_key_t<Key>, Stream> ret_val;
+	for (auto&& val : m_buf)
+	{
+		auto [it, inserted] = ret_val.try_emplace(std::invoke(key_func, std::as_const(val)));
+		if (inserted)
+			it->second.m_text = m_text;
+
+		it->second.m_buf.push_back(std::move(val));
+	}
+
+	clear();
+
+	return ret_val;
+}
+
+template<typename T, typename Container>
+inline typename Stream<T, Container>::_Cont Stream<T, Container>::get_subseq(_Iter first, _Iter last) const
+{
+	return _Cont(first, last);
+}
+
+template<typename T, typename Container>
+inline std::pair<bool, typename Stream<T, Container>::_Const_Iter> Stream<T, Container>::find_subseq(std::string const& crPattern) const
+{
+	return find_subseq(Pattern<_T>(crPattern));
+}
+
+template<typename T, typename Container>
+inline std::pair<bool, typename Stream<T, Container>::_Const_Iter> Stream<T, Container>::find_subseq(Pattern<_T> const& crPattern) const
+{
+	const auto it{ crPattern.find(cbegin(), cend()) };
+
+	return { it != cend(), it };
+}
+
+template<typename T, typename Container>
+template<typename Policy, typename>
+inline std::pair<bool, typename Stream<T, Container>::_Const_Iter> Stream<T, Container>::find_subseq(Policy&& policy, std::string const& crPattern) const
+{
+	return find_subseq(std::forward<Policy>(policy), Pattern<_T>(crPattern));
+}
+
+template<typename T, typename Container>
+template<typename Policy, typename>
+std::pair<bool, typename Stream<T, Container>::_Const_Iter> Stream<T, Container>::find_subseq(Policy&&, Pattern<_T> const& crPattern) const
+{
+	if constexpr (!execution::is_parallel_policy_v<Policy> || !_random_access)
+		return find_subseq(crPattern);
+	else
+	{
+		const std::size_t size{ this->size() };
+		if (crPattern.size() > size)
+			return { false, cend() };
+
+		// Chunks split the possible starting positions, a match may run past the end of its chunk
+		const std::size_t        starts{ size - crPattern.size() + 1 };
+		const std::size_t        nChunks{ chunk_count(starts) };
+		std::atomic<std::size_t> found(starts);
+		for_chunks(nChunks, starts, [&](std::size_t, std::size_t first, std::size_t last)
+		{
+			if (found.load(std::memory_order_relaxed) < first)
+				return;
+
+			const auto it{ crPattern.find(cbegin() + first, cbegin() + (last + crPattern.size() - 1)) };
+			if (const std::size_t pos{ static_cast<std::size_t>(it - cbegin()) }; pos < last)
+				for (auto prev{ found.load() }; pos < prev && !found.compare_exchange_weak(prev, pos); )
+					;
+		});
+
+		if (found.load() == starts)
+			return { false, cend() };
+
+		return { true, cbegin() + found.load() };
+	}
+}
+
+template<typename T, typename Container>
+inline std::vector<std::size_t> Stream<T, Container>::find_all(Pattern<_T> const& crPattern) const
+{
+	return crPattern.find_all(cbegin(), cend());
+}
+
+template<typename T, typename Container>
+inline std::size_t Stream<T, Container>::count(Pattern<_T> const& crPattern) const
+{
+	return crPattern.count(cbegin(), cend());
+}
+
+template<typename T, typename Container>
+template<typename Compare>
+inline Stream<T, Container>& Stream<T, Container>::merge(std::vector<std::reference_wrapper<Stream>> const& crStreams, Compare comp)
+{
+	return merge(execution::seq, crStreams, std::move(comp));
+}
+
+template<typename T, typename Container>
+template<typename Policy, typename Compare, typename>
+Stream<T, Container>& Stream<T, Container>::merge(Policy&&, std::vector<std::reference_wrapper<Stream>> const& crStreams, Compare comp)
+{
+	compact();
+
+	std::vector<std::pair<_Iter, _Iter>> ranges{ { std::begin(m_buf), std::end(m_buf) } };
+	std::size_t                          total{ std::size(m_buf) };
+	for (Stream& rStream : crStreams)
+		if (&rStream != this)
+		{
+			rStream.compact();
+			ranges.emplace_back(std::begin(rStream.m_buf), std::end(rStream.m_buf));
+			total += std::size(rStream.m_buf);
+		}
+
+	_Cont cont;
+	if constexpr (execution::is_parallel_policy_v<Policy> && _random_access && std::is_default_constructible_v<_T>)
+	{
+		const auto cuts{ merge_split(ranges, chunk_count(total), comp) };
+
+		cont.resize(total);
+		ThreadPool::instance().parallel_for(cuts.size() - 1, [&](std::size_t part)
+		{
+			std::vector<std::pair<_Iter, _Iter>> parts(ranges.size());
+			std::size_t                          offset{};
+			for (std::size_t i{}; i < ranges.size(); ++i)
+			{
+				parts[i] = { ranges[i].first + cuts[part][i], ranges[i].first + cuts[part + 1][i] };
+				offset  += cuts[part][i];
+			}
+
+			merge_ranges(std::move(parts), std::begin(cont) + offset, comp);
+		});
+	}
+	else
+	{
+		if constexpr (has_reserve<_Cont>::value)
+			cont.reserve(total);
+
+		merge_ranges(std::move(ranges), std::back_inserter(cont), std::move(comp));
+	}
+
+	using std::swap; // Enable all swaps
+	swap(m_buf, cont);
+
+	for (Stream& rStream : crStreams)
+		if (&rStream != this)
+		{
+			// Views into the arenas of the other streams have to stay valid after they are gone
+			if constexpr (_string_view)
+			{
+				if (rStream.m_text.pArena)
+					m_text.adopted.push_back(rStream.m_text.pArena);
+
+				m_text.adopted.insert(std::end(m_text.adopted), std::begin(rStream.m_text.adopted), std::end(rStream.m_text.adopted));
+			}
+
+			rStream.clear();
+		}
+
+	return (*this);
+}
+
+template<typename T, typename Container>
+template<typename F>
+std::vector<Stream<T, Container>> Stream<T, Container>::separate(std::size_t nStreams, F&& key_func)
+{
+	compact();
+
+	// Keys are computed once; counting them first lets every output be allocated at its final size
+	std::vector<std::size_t> keys;
+	keys.reserve(std::size(m_buf));
+
+	std::vector<std::size_t> counts(nStreams);
+	for (auto&& val : m_buf)
+	{
+		const auto key{ static_cast<std::size_t>(std::invoke(key_func, val)) };
+		if (key >= nStreams)
+			throw std::out_of_range("Wrong stream index.");
+
+		keys.push_back(key);
+		++counts[key];
+	}
+
+	std::vector<Stream> ret_val(nStreams);
+	for (std::size_t i{}; i < nStreams; ++i)
+	{
+		if constexpr (has_reserve<_Cont>::value)
+			ret_val[i].m_buf.reserve(counts[i]);
+
+		ret_val[i].m_text = m_text;
+	}
+
+	auto key{ std::cbegin(keys) };
+	for (auto&& val : m_buf)
+		ret_val[*key++].m_buf.push_back(std::move(val));
+
+	clear();
+
+	return ret_val;
+}
+
+template<typename T, typename Container>
+inline bool Stream<T, Container>::writer_matches(std::ostream& rOstr)
+{
+	using std::ios_base;
+
+	// Default flags and the classic locale, precision is taken into account by the writer up to what it can format in place
+	constexpr auto formatting{ ios_base::basefield | ios_base::floatfield | ios_base::adjustfield | ios_base::showbase |
+	                           ios_base::showpoint | ios_base::showpos | ios_base::uppercase | ios_base::boolalpha };
+
+	return (Writer::direct_v<_T> && (rOstr.flags() & formatting) == ios_base::dec && !rOstr.width() && rOstr.fill() == ' ' &&
+	        rOstr.getloc() == std::locale::classic() &&
+	        (!std::is_floating_point_v<_T> || rOstr.precision() <= Writer::max_precision));
+}
+
+template<typename T, typename Container>
+void Stream<T, Container>::dump(std::ostream &rOstr, DumpLayout layout) const noexcept
+{
+	try
+	{
+		rOstr << "\t[STREAM DUMP]\nStream<" << typeid(_T).name() << ", " << typeid(_Cont).name() << "> [0x" << this << "]\n"
+			<< "{\n\t buffer [" << size() << "] = 0x" << &m_buf << "\n\t{\n";
+
+		// Whole lines are formatted in a buffer and the stream is flushed once at the end
+		const std::size_t width{ std::is_arithmetic_v<_T> ? sizeof(_T) : 0 };
+		if (empty())
+			rOstr << "\t\tempty\n";
+		else if (writer_matches(rOstr))
+		{
+			const int precision{ static_cast<int>(rOstr.precision()) };
+
+			Writer writer(rOstr);
+			if (layout == DumpLayout::flat)
+				writer.write("\t\t");
+
+			std::size_t i{};
+			for (auto it{ cbegin() }; it != cend(); ++it, ++i)
+				if (layout == DumpLayout::flat)
+					writer.write(*it, precision).put(' ');
+				else
+				{
+					writer.write("\t\t[").write(i).write("] = ");
+					writer.write(*it, precision, width).put('\n');
+				}
+
+			if (layout == DumpLayout::flat)
+				writer.put('\n');
+		}
+		else
+		{
+			if (layout == DumpLayout::flat)
+				rOstr << "\t\t";
+
+			std::size_t i{};
+			for (auto it{ cbegin() }; it != cend(); ++it, ++i)
+				if (layout == DumpLayout::flat)
+					rOstr << *it << ' ';
+				else
+				{
+					rOstr << "\t\t[" << i << "] = ";
+
+					if (width)
+						rOstr << std::setw(width);
+
+					rOstr << *it << '\n';
+				}
+
+			if (layout == DumpLayout::flat)
+				rOstr << '\n';
+		}
+
+		rOstr << "\t}\n}" << std::endl;
+	}
+	catch (std::exception const& crException)
+	{
+		std::cerr << "[ERROR] " << crException.what() << std::endl;
+
+		std::terminate();
+	}
+	catch (...)
+	{
+		std::cerr << "[FATAL] Unknown error." << std::endl;
+
+		std::terminate();
+	}
+}
+
+template<typename T, typename Container>
+void Stream<T, Container>::write(Writer& rWriter, char delim) const
+{
+	bool first{ true };
+	for (auto it{ cbegin() }; it != cend(); ++it, first = false)
+	{
+		if (!first)
+			rWriter.put(delim);
+
+		rWriter.write(*it);
+	}
+
+	rWriter.put('\n');
+}
+
+template<typename T, typename Container>
+inline void Stream<T, Container>::write(std::ostream& rOstr, char delim) const
+{
+	Writer writer(rOstr);
+	write(writer, delim);
+	writer.flush();
+}
+
+template<typename T, typename Container>
+inline void Stream<T, Container>::write(int fd, char delim) const
+{
+	Writer writer(fd);
+	write(writer, delim);
+	writer.flush();
+}
+
+template<typename T, typename Cont>
+Stream<T, Cont>& Stream<T, Cont>::operator<<(std::string const& crString)
+{
+	parse(crString);
+
+	return (*this);
+}
+
+template<typename T, typename Container>
+inline Stream<T, Container>& Stream<T, Container>::operator>>(_T& rVal)
+{
+	if (empty())
+		throw std::out_of_range("Stream is empty.");
+
+	if constexpr (has_pop_front<_Cont>::value)
+	{
+		rVal = std::move(m_buf.front());
+		m_buf.pop_front();
+	}
+	else
+	{
+		rVal = std::move(*begin());
+
+		// Compacting once half of the buffer is consumed moves at most as many elements as were taken
+		if (++m_head == std::size(m_buf))
+			clear();
+		else if (m_head >= _min_compact && 2 * m_head >= std::size(m_buf))
+			compact();
+	}
+
+	return (*this);
+}
+
+template<typename T, typename Container>
+std::size_t Stream<T, Container>::pop_n(_T* pDst, std::size_t count)
+{
+	if (count > size())
+		count = size();
+
+	std::move(begin(), std::next(begin(), count), pDst);
+
+	if constexpr (has_pop_front<_Cont>::value)
+		m_buf.erase(std::begin(m_buf), std::next(std::begin(m_buf), count));
+	else if ((m_head += count) == std::size(m_buf))
+		clear();
+	else if (m_head >= _min_compact && 2 * m_head >= std::size(m_buf))
+		compact();
+
+	return count;
+}
+
+template<typename T, typename Container>
+inline Stream<T, Container>& Stream<T, Container>::operator=(std::initializer_list<_T> list)
+{
+	_Cont cont(list.begin(), list.end());
+
+	using std::swap; // Enable all swaps
+	swap(m_buf, cont);
+	m_head = 0;
+
+	return (*this);
+}
+
+template<typename T, typename Container>
+inline Stream<T, Container>& Stream<T, Container>::operator=(Stream&& rrStream) noexcept
+{
+	Stream tmp(std::move(rrStream));
+
+	using std::swap; // Enable all swaps
+	swap(m_buf, tmp.m_buf);
+	swap(m_head, tmp.m_head);
+	swap(m_text, tmp.m_text);
+
+	return (*this);
+}
+
+template<typename T, typename Cont>
+std::istream& operator>>(std::istream &rIstr, Stream<T, Cont>& rStream)
+{
+	std::string str;
+	std::getline(rIstr, str, '\n');
+
+	rStream << str;
+
+	return rIstr;
+}
+
+template<typename T, typename Cont>
+std::ostream& operator<<(std::ostream &rOstr, Stream<T, Cont> const& crStream)
+{
+	if (crStream.empty())
+		rOstr << "empty";
+	else if (Stream<T, Cont>::writer_matches(rOstr))
+	{
+		const int precision{ static_cast<int>(rOstr.precision()) };
+
+		Writer writer(rOstr);
+		for (auto it{ crStream.cbegin() }; it != crStream.cend(); ++it)
+			writer.write(*it, precision).put(' ');
+	}
+	else
+		for (auto it{ crStream.cbegin() }; it != crStream.cend(); ++it)
+			rOstr << *it << " ";
+
+	rOstr << std::endl;
+
+	return rOstr;
+}
+
+// Stream whose producers and consumers run on different threads. operator<< parses and blocks while the channel
+// is full, operator>> blocks while it is empty. Ring is SpscRing<T> for a single producer and a single consumer.
+template<typename T, typename Ring = MpmcRing<T>>
+class ConcurrentStream
+{
+	using _T = T;
+
+public:
+	explicit ConcurrentStream(std::size_t capacity = 1024);
+	ConcurrentStream(ConcurrentStream const&) = delete;
+	ConcurrentStream(ConcurrentStream&&) = delete;
+
+	ConcurrentStream& operator=(ConcurrentStream const&) = delete;
+	ConcurrentStream& operator=(ConcurrentStream&&)      = delete;
+
+	[[nodiscard]]
+	inline Channel<_T, Ring>& channel() noexcept;
+
+	// Pushes everything the stream holds, leaving it empty. If the channel gets closed, the elements that didn't get in
+	// stay in the stream and std::runtime_error is thrown.
+	template<typename Container>
+	ConcurrentStream& operator<<(Stream<_T, Container>& rStream);
+
+	ConcurrentStream& operator<<(std::string_view str);
+
+	// Throws std::out_of_range once the stream is closed and drained
+	ConcurrentStream& operator>>(_T& rVal);
+
+	// Same as operator>> but returns false instead of throwing
+	[[nodiscard]]
+	inline bool pop(_T& rVal);
+
+	[[nodiscard]]
+	inline std::size_t pop_n(_T* pDst, std::size_t count);
+
+	// Consumers get the remaining elements and then the end of the stream
+	inline void close();
+
+private:
+	Channel<_T, Ring> m_channel;
+};
+
+template<typename T, typename Ring>
+inline ConcurrentStream<T, Ring>::ConcurrentStream(std::size_t capacity) :
+	m_channel(capacity)
+{ }
+
+template<typename T, typename Ring>
+inline Channel<T, Ring>& ConcurrentStream<T, Ring>::channel() noexcept
+{
+	return m_channel;
+}
+
+template<typename T, typename Ring>
+template<typename Container>
+ConcurrentStream<T, Ring>& ConcurrentStream<T, Ring>::operator<<(Stream<_T, Container>& rStream)
+{
+	_T buf[64];
+	while (!rStream.empty())
+	{
+		const std::size_t count{ rStream.size() < std::size(buf) ? rStream.size() : std::size(buf) };
+		const auto        first{ rStream.begin() };
+		std::move(first, std::next(first, count), buf);
+
+		// push_n moves only what gets in, the rest goes back in place
+		const std::size_t pushed{ m_channel.push_n(buf, count) };
+		std::move(buf + pushed, buf + count, std::next(first, pushed));
+
+		// Drops the moved-from front
+		rStream.pop_n(buf, pushed);
+
+		if (pushed != count)
+			throw std::runtime_error("Stream is closed.");
+	}
+
+	return (*this);
+}
+
+template<typename T, typename Ring>
+ConcurrentStream<T, Ring>& ConcurrentStream<T, Ring>::operator<<(std::string_view str)
+{
+	Tokenizer tokens(str);
+	for (_T tmp{}; tokens.next(tmp); tmp = _T{})
+		if (!m_channel.push(std::move(tmp)))
+			throw std::runtime_error("Stream is closed.");
+
+	return (*this);
+}
+
+template<typename T, typename Ring>
+ConcurrentStream<T, Ring>& ConcurrentStream<T, Ring>::operator>>(_T& rVal)
+{
+	if (!m_channel.pop(rVal))
+		throw std::out_of_range("Stream is empty.");
+
+	return (*this);
+}
+
+template<typename T, typename Ring>
+inline bool ConcurrentStream<T, Ring>::pop(_T& rVal)
+{
+	return m_channel.pop(rVal);
+}
+
+template<typename T, typename Ring>
+inline std::size_t ConcurrentStream<T, Ring>::pop_n(_T* pDst, std::size_t count)
+{
+	return m_channel.pop_n(pDst, count);
+}
+
+template<typename T, typename Ring>
+inline void ConcurrentStream<T, Ring>::close()
+{
+	m_channel.close();
 }
 
 #endif /* __STREAM_HPP_INCLUDED__ */
\ No newline at end of file
@@ -0,0 +1,245 @@
+#pragma once
+
+#ifndef __THREADPOOL_HPP_INCLUDED__
+#define __THREADPOOL_HPP_INCLUDED__
+
+#ifndef __cplusplus
+#error
+#error Must use C++ to compile.
+#error
+#endif /* __cplusplus */
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace execution
+{
+	struct sequenced_policy { };
+	struct parallel_policy { };
+	struct parallel_unsequenced_policy { };
+
+	inline constexpr sequenced_policy            seq{};
+	inline constexpr parallel_policy             par{};
+	inline constexpr parallel_unsequenced_policy par_unseq{};
+
+	template<typename T>
+	struct is_execution_policy : std::false_type { };
+
+	template<>
+	struct is_execution_policy<sequenced_policy> : std::true_type { };
+
+	template<>
+	struct is_execution_policy<parallel_policy> : std::true_type { };
+
+	template<>
+	struct is_execution_policy<parallel_unsequenced_policy> : std::true_type { };
+
+	template<typename T>
+	inline constexpr bool is_execution_policy_v = is_execution_policy<std::decay_t<T>>::value;
+
+	template<typename T>
+	inline constexpr bool is_parallel_policy_v = is_execution_policy_v<T> && !std::is_same_v<std::decay_t<T>, sequenced_policy>;
+} // namespace execution
+
+// Every worker owns a deque: it takes its own tasks from the back and steals from the front of the others.
+// The thread waiting in parallel_for runs queued tasks too, so nested calls don't deadlock.
+class ThreadPool
+{
+	using _Task = std::function<void()>;
+
+	struct _Queue
+	{
+		std::mutex        mutex;
+		std::deque<_Task> tasks;
+	};
+
+public:
+	explicit ThreadPool(std::size_t nThreads = std::thread::hardware_concurrency());
+	ThreadPool(ThreadPool const&) = delete;
+	ThreadPool(ThreadPool&&) = delete;
+	~ThreadPool();
+
+	ThreadPool& operator=(ThreadPool const&) = delete;
+	ThreadPool& operator=(ThreadPool&&)      = delete;
+
+	// Pool shared by all parallel Stream operations
+	[[nodiscard]]
+	static ThreadPool& instance();
+
+	// Number of threads including the calling one
+	[[nodiscard]]
+	inline std::size_t size() const noexcept;
+
+	// Calls func(i) for every i in [0, nTasks) and waits for all of them. The first exception thrown is rethrown.
+	template<typename F>
+	void parallel_for(std::size_t nTasks, F&& func);
+
+private:
+	void push(std::size_t queue, _Task task);
+	bool try_run_one(std::size_t first);
+	void worker(std::size_t index);
+
+	std::vector<std::unique_ptr<_Queue>> m_queues;
+	std::vector<std::thread>             m_threads;
+	std::mutex                           m_mutex;
+	std::condition_variable              m_cv;
+	std::atomic<std::size_t>             m_pending;
+	bool                                 m_stop;
+};
+
+inline ThreadPool::ThreadPool(std::size_t nThreads) :
+	m_queues(),
+	m_threads(),
+	m_mutex(),
+	m_cv(),
+	m_pending(0),
+	m_stop(false)
+{
+	const std::size_t nWorkers{ nThreads > 1 ? nThreads - 1 : 0 };
+	for (std::size_t i{}; i < nWorkers; ++i)
+		m_queues.push_back(std::make_unique<_Queue>());
+
+	for (std::size_t i{}; i < nWorkers; ++i)
+		m_threads.emplace_back(&ThreadPool::worker, this, i);
+}
+
+inline ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_cv.notify_all();
+
+	for (auto& thread : m_threads)
+		thread.join();
+}
+
+inline ThreadPool& ThreadPool::instance()
+{
+	static ThreadPool pool;
+
+	return pool;
+}
+
+inline std::size_t ThreadPool::size() const noexcept
+{
+	return m_threads.size() + 1;
+}
+
+inline void ThreadPool::push(std::size_t queue, _Task task)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_queues[queue]->mutex);
+		m_queues[queue]->tasks.push_back(std::move(task));
+	}
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	++m_pending;
+}
+
+inline bool ThreadPool::try_run_one(std::size_t first)
+{
+	const std::size_t nQueues{ m_queues.size() };
+	for (std::size_t i{}; i < nQueues; ++i)
+	{
+		auto& queue{ *m_queues[(first + i) % nQueues] };
+
+		_Task task;
+		{
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			if (queue.tasks.empty())
+				continue;
+
+			if (i)
+			{
+				task = std::move(queue.tasks.front());
+				queue.tasks.pop_front();
+			}
+			else
+			{
+				task = std::move(queue.tasks.back());
+				queue.tasks.pop_back();
+			}
+		}
+
+		--m_pending;
+		task();
+
+		return true;
+	}
+
+	return false;
+}
+
+inline void ThreadPool::worker(std::size_t index)
+{
+	for (;;)
+	{
+		if (try_run_one(index))
+			continue;
+
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_cv.wait(lock, [this] { return m_stop || m_pending.load() > 0; });
+		if (m_stop)
+			break;
+	}
+}
+
+template<typename F>
+void ThreadPool::parallel_for(std::size_t nTasks, F&& func)
+{
+	if (!nTasks)
+		return;
+
+	if (nTasks == 1 || m_queues.empty())
+	{
+		for (std::size_t i{}; i < nTasks; ++i)
+			func(i);
+
+		return;
+	}
+
+	std::atomic<std::size_t> remaining(nTasks);
+	std::exception_ptr       exception;
+	std::mutex               exceptionMutex;
+
+	auto run = [&](std::size_t i)
+	{
+		try
+		{
+			func(i);
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> lock(exceptionMutex);
+			if (!exception)
+				exception = std::current_exception();
+		}
+
+		--remaining;
+	};
+
+	for (std::size_t i{ 1 }; i < nTasks; ++i)
+		push(i % m_queues.size(), [&run, i] { run(i); });
+	m_cv.notify_all();
+
+	run(0);
+
+	while (remaining.load())
+		if (!try_run_one(0))
+			std::this_thread::yield();
+
+	if (exception)
+		std::rethrow_exception(exception);
+}
+
+#endif /* __THREADPOOL_HPP_INCLUDED__ */
@@ -0,0 +1,262 @@
+#pragma once
+
+#ifndef __TOKENIZER_HPP_INCLUDED__
+#define __TOKENIZER_HPP_INCLUDED__
+
+#ifndef __cplusplus
+#error
+#error Must use C++ to compile.
+#error
+#endif /* __cplusplus */
+
+#include <charconv>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TOKENIZER_SSE2
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif /* _MSC_VER */
+#endif /* __SSE2__ */
+
+class parse_error : public std::runtime_error
+{
+public:
+	parse_error(std::string const& crWhat, std::size_t position) :
+		std::runtime_error(crWhat),
+		m_position(position)
+	{ }
+
+	// Offset of the offending character in the parsed string
+	[[nodiscard]]
+	std::size_t position() const noexcept { return m_position; }
+
+private:
+	std::size_t m_position;
+};
+
+// Splits a string_view into tokens separated by whitespace or by the extra delimiter without copying it.
+// Numbers are converted with from_chars, other types fall back to operator>>.
+class Tokenizer
+{
+	template<typename T>
+	static constexpr bool _from_chars_v = std::is_floating_point_v<T> ||
+		(std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char> && !std::is_same_v<T, signed char> &&
+		 !std::is_same_v<T, unsigned char> && !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>);
+
+public:
+	// Error positions are reported relative to base, for strings that are a part of a larger input
+	explicit Tokenizer(std::string_view str, char delim = ' ', std::size_t base = 0) noexcept;
+
+	[[nodiscard]]
+	inline bool is_delim(char c) const noexcept;
+
+	// Moves to the next token, returns false at the end of the string
+	[[nodiscard]]
+	bool next(std::string_view& rToken) noexcept;
+
+	// Reads and converts the next token, returns false at the end of the string.
+	// Numbers are parsed straight from the string, so the token end isn't searched for twice.
+	template<typename T>
+	[[nodiscard]]
+	bool next(T& rVal);
+
+	// Converts the whole token or throws parse_error pointing at the first character that doesn't belong to the value
+	template<typename T>
+	void parse(std::string_view token, T& rVal) const;
+
+private:
+	[[nodiscard]]
+	std::size_t skip_delims(std::size_t pos) const noexcept;
+
+	[[nodiscard]]
+	std::size_t find_delim(std::size_t pos) const noexcept;
+
+	[[noreturn]]
+	void fail(char const* pWhere) const;
+
+	// Skips the sign from_chars doesn't take but operator>> does
+	[[nodiscard]]
+	static char const* skip_plus(char const* first, char const* last) noexcept;
+
+#ifdef TOKENIZER_SSE2
+	// Bit i is set when byte i of the 16 at pos is a delimiter
+	[[nodiscard]]
+	inline unsigned delim_mask(std::size_t pos) const noexcept;
+
+	[[nodiscard]]
+	static inline unsigned first_bit(unsigned mask) noexcept;
+#endif /* TOKENIZER_SSE2 */
+
+	std::string_view m_str;
+	std::size_t      m_pos;
+	std::size_t      m_base;
+	char             m_delim;
+};
+
+inline Tokenizer::Tokenizer(std::string_view str, char delim, std::size_t base) noexcept :
+	m_str(str),
+	m_pos(0),
+	m_base(base),
+	m_delim(delim)
+{ }
+
+inline bool Tokenizer::is_delim(char c) const noexcept
+{
+	// ' ', '\t', '\n', '\v', '\f', '\r'
+	return (c == ' ' || static_cast<unsigned char>(c - '\t') <= '\r' - '\t' || c == m_delim);
+}
+
+#ifdef TOKENIZER_SSE2
+inline unsigned Tokenizer::delim_mask(std::size_t pos) const noexcept
+{
+	const __m128i chars{ _mm_loadu_si128(reinterpret_cast<__m128i const*>(m_str.data() + pos)) };
+	const __m128i ctrl{ _mm_sub_epi8(chars, _mm_set1_epi8('\t')) };
+	const __m128i space{ _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(chars, _mm_set1_epi8(m_delim))) };
+	const __m128i range{ _mm_cmpeq_epi8(_mm_min_epu8(ctrl, _mm_set1_epi8('\r' - '\t')), ctrl) };
+
+	return static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(space, range)));
+}
+
+inline unsigned Tokenizer::first_bit(unsigned mask) noexcept
+{
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward(&index, mask);
+
+	return static_cast<unsigned>(index);
+#else
+	return static_cast<unsigned>(__builtin_ctz(mask));
+#endif /* _MSC_VER */
+}
+#endif /* TOKENIZER_SSE2 */
+
+inline std::size_t Tokenizer::skip_delims(std::size_t pos) const noexcept
+{
+	// Usually there is a single separator, which the caller has already stepped over
+	if (pos < m_str.size() && !is_delim(m_str[pos]))
+		return pos;
+
+#ifdef TOKENIZER_SSE2
+	for (; pos + 16 <= m_str.size(); pos += 16)
+		if (const unsigned mask{ ~delim_mask(pos) & 0xFFFFu }; mask)
+			return pos + first_bit(mask);
+#endif /* TOKENIZER_SSE2 */
+
+	while (pos < m_str.size() && is_delim(m_str[pos]))
+		++pos;
+
+	return pos;
+}
+
+inline std::size_t Tokenizer::find_delim(std::size_t pos) const noexcept
+{
+#ifdef TOKENIZER_SSE2
+	for (; pos + 16 <= m_str.size(); pos += 16)
+		if (const unsigned mask{ delim_mask(pos) }; mask)
+			return pos + first_bit(mask);
+#endif /* TOKENIZER_SSE2 */
+
+	while (pos < m_str.size() && !is_delim(m_str[pos]))
+		++pos;
+
+	return pos;
+}
+
+inline bool Tokenizer::next(std::string_view& rToken) noexcept
+{
+	const std::size_t first{ skip_delims(m_pos) };
+	if (first == m_str.size())
+	{
+		m_pos = first;
+
+		return false;
+	}
+
+	m_pos  = find_delim(first);
+	rToken = m_str.substr(first, m_pos - first);
+	m_pos += (m_pos != m_str.size());
+
+	return true;
+}
+
+inline void Tokenizer::fail(char const* pWhere) const
+{
+	const std::size_t position{ m_base + static_cast<std::size_t>(pWhere - m_str.data()) };
+
+	throw parse_error("Wrong input at position " + std::to_string(position) + ".", position);
+}
+
+inline char const* Tokenizer::skip_plus(char const* first, char const* last) noexcept
+{
+	return ((first != last && *first == '+' && last - first > 1 && first[1] != '-') ? first + 1 : first);
+}
+
+template<typename T>
+inline bool Tokenizer::next(T& rVal)
+{
+	if constexpr (_from_chars_v<T>)
+	{
+		m_pos = skip_delims(m_pos);
+		if (m_pos == m_str.size())
+			return false;
+
+		const auto last{ m_str.data() + m_str.size() };
+		const auto first{ skip_plus(m_str.data() + m_pos, last) };
+
+		auto [ptr, ec] = std::from_chars(first, last, rVal);
+		if (ec != std::errc())
+			fail(first);
+		if (ptr != last && !is_delim(*ptr))
+			fail(ptr);
+
+		m_pos = static_cast<std::size_t>(ptr - m_str.data()) + (ptr != last);
+
+		return true;
+	}
+	else
+	{
+		std::string_view token;
+		if (!next(token))
+			return false;
+
+		parse(token, rVal);
+
+		return true;
+	}
+}
+
+template<typename T>
+inline void Tokenizer::parse(std::string_view token, T& rVal) const
+{
+	if constexpr (_from_chars_v<T>)
+	{
+		const auto first{ skip_plus(token.data(), token.data() + token.size()) };
+		const auto last{ token.data() + token.size() };
+
+		auto [ptr, ec] = std::from_chars(first, last, rVal);
+		if (ec != std::errc())
+			fail(first);
+		if (ptr != last)
+			fail(ptr);
+	}
+	else if constexpr (std::is_assignable_v<T&, std::string_view>)
+		rVal = token;
+	else
+	{
+		std::istringstream ss{ std::string(token) };
+		if (!(ss >> rVal))
+			fail(token.data());
+		if (ss.rdbuf()->in_avail() > 0)
+			fail(token.data() + static_cast<std::size_t>(ss.tellg()));
+	}
+}
+
+#endif /* __TOKENIZER_HPP_INCLUDED__ */
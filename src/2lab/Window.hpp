@@ -0,0 +1,124 @@
+#pragma once
+
+#ifndef __WINDOW_HPP_INCLUDED__
+#define __WINDOW_HPP_INCLUDED__
+
+#ifndef __cplusplus
+#error
+#error Must use C++ to compile.
+#error
+#endif /* __cplusplus */
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Aggregate of a FIFO window in O(1) amortized per push and pop for any associative reduce_func, using two stacks.
+// New elements go on the back stack which keeps a running aggregate; once the front stack runs out the back one is
+// poured into it, each element getting the aggregate of itself and everything newer on the front stack.
+// Elements are combined the way Stream::reduce does it: reduce_func(newer, older).
+template<typename T, typename F>
+class SlidingWindow
+{
+	using _T = T;
+
+	struct _Entry
+	{
+		_T val;
+		_T agg;
+	};
+
+public:
+	explicit SlidingWindow(F reduce_func);
+
+	[[nodiscard]]
+	inline std::size_t size() const noexcept;
+
+	[[nodiscard]]
+	inline bool empty() const noexcept;
+
+	void push(_T val);
+
+	// Drops the oldest element
+	void pop();
+
+	// Aggregate of the whole window, which must not be empty
+	[[nodiscard]]
+	_T value() const;
+
+	void clear() noexcept;
+
+private:
+	std::vector<_Entry> m_front; // Oldest element on top
+	std::vector<_Entry> m_back;  // Newest element on top
+	F                   m_func;
+};
+
+template<typename T, typename F>
+inline SlidingWindow<T, F>::SlidingWindow(F reduce_func) :
+	m_front(),
+	m_back(),
+	m_func(std::move(reduce_func))
+{ }
+
+template<typename T, typename F>
+inline std::size_t SlidingWindow<T, F>::size() const noexcept
+{
+	return m_front.size() + m_back.size();
+}
+
+template<typename T, typename F>
+inline bool SlidingWindow<T, F>::empty() const noexcept
+{
+	return (m_front.empty() && m_back.empty());
+}
+
+template<typename T, typename F>
+inline void SlidingWindow<T, F>::push(_T val)
+{
+	_T agg{ m_back.empty() ? val : std::invoke(m_func, val, m_back.back().agg) };
+
+	m_back.push_back({ std::move(val), std::move(agg) });
+}
+
+template<typename T, typename F>
+void SlidingWindow<T, F>::pop()
+{
+	if (empty())
+		throw std::out_of_range("Window is empty.");
+
+	if (m_front.empty())
+		for (; !m_back.empty(); m_back.pop_back())
+		{
+			_T& rVal{ m_back.back().val };
+			_T  agg{ m_front.empty() ? rVal : std::invoke(m_func, m_front.back().agg, rVal) };
+
+			m_front.push_back({ std::move(rVal), std::move(agg) });
+		}
+
+	m_front.pop_back();
+}
+
+template<typename T, typename F>
+inline typename SlidingWindow<T, F>::_T SlidingWindow<T, F>::value() const
+{
+	if (empty())
+		throw std::out_of_range("Window is empty.");
+
+	if (m_front.empty())
+		return m_back.back().agg;
+	if (m_back.empty())
+		return m_front.back().agg;
+
+	return std::invoke(m_func, m_back.back().agg, m_front.back().agg);
+}
+
+template<typename T, typename F>
+inline void SlidingWindow<T, F>::clear() noexcept
+{
+	m_front.clear();
+	m_back.clear();
+}
+
+#endif /* __WINDOW_HPP_INCLUDED__ */
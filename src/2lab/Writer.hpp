@@ -0,0 +1,245 @@
+#pragma once
+
+#ifndef __WRITER_HPP_INCLUDED__
+#define __WRITER_HPP_INCLUDED__
+
+#ifndef __cplusplus
+#error
+#error Must use C++ to compile.
+#error
+#endif /* __cplusplus */
+
+#include <cerrno>
+#include <charconv>
+#include <climits>
+#include <cstring>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <io.h>
+#else
+#include <unistd.h>
+#endif /* _MSC_VER */
+
+inline constexpr std::size_t WRITER_BUFFER_SIZE = 1 << 16;
+
+// Formats values into a large buffer and hands it to an ostream or a file descriptor only when it fills up,
+// so writing an element costs a to_chars call instead of a pass through the iostream machinery.
+class Writer
+{
+	template<typename T>
+	static constexpr bool _to_chars_v = std::is_floating_point_v<T> ||
+		(std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char> && !std::is_same_v<T, signed char> &&
+		 !std::is_same_v<T, unsigned char> && !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>);
+
+	// Longest number to_chars produces: a double with 17 significant digits, exponent and signs
+	static constexpr std::size_t _max_number = 64;
+
+public:
+	// T is written without going through operator<<
+	template<typename T>
+	static constexpr bool direct_v = _to_chars_v<T> || std::is_same_v<T, char> || std::is_convertible_v<T const&, std::string_view>;
+
+	// Largest precision a floating point value is formatted with in place: digits, sign, point and a 4 digit exponent
+	static constexpr int max_precision = static_cast<int>(_max_number) - 8;
+
+	explicit Writer(std::ostream& rOstr, std::size_t size = WRITER_BUFFER_SIZE);
+	explicit Writer(int fd, std::size_t size = WRITER_BUFFER_SIZE);
+	Writer(Writer const&) = delete;
+
+	Writer& operator=(Writer const&) = delete;
+
+	// Flushes what is left, errors are lost here: call flush to see them
+	~Writer() noexcept;
+
+	inline Writer& put(char c);
+
+	Writer& write(std::string_view str);
+
+	// Floating point values take the shortest form that reads back exactly, or precision significant digits like
+	// std::ostream does by default. Values are right-aligned to width like std::setw does.
+	template<typename T>
+	Writer& write(T const& crVal, int precision = -1, std::size_t width = 0);
+
+	// Hands the buffer to the sink, the ostream is flushed as well
+	void flush();
+
+private:
+	void drain();
+
+	// Formats through operator<<, for types to_chars doesn't know and values that don't fit in its buffer
+	template<typename T>
+	Writer& write_formatted(T const& crVal, int precision, std::size_t width);
+
+	std::vector<char> m_buf;
+	std::size_t       m_size;
+	std::ostream*     m_pOstr;
+	int               m_fd;
+};
+
+inline Writer::Writer(std::ostream& rOstr, std::size_t size) :
+	m_buf(size < _max_number ? _max_number : size),
+	m_size(0),
+	m_pOstr(&rOstr),
+	m_fd(-1)
+{ }
+
+inline Writer::Writer(int fd, std::size_t size) :
+	m_buf(size < _max_number ? _max_number : size),
+	m_size(0),
+	m_pOstr(nullptr),
+	m_fd(fd)
+{ }
+
+inline Writer::~Writer() noexcept
+{
+	try
+	{
+		drain();
+	}
+	catch (...)
+	{ }
+}
+
+inline void Writer::drain()
+{
+	if (m_pOstr)
+	{
+		if (m_size && m_pOstr->rdbuf()->sputn(m_buf.data(), static_cast<std::streamsize>(m_size)) != static_cast<std::streamsize>(m_size))
+			m_pOstr->setstate(std::ios_base::badbit);
+
+		m_size = 0;
+
+		return;
+	}
+
+	for (std::size_t done{}; done < m_size; )
+	{
+		const std::size_t n{ m_size - done };
+#ifdef _MSC_VER
+		const int written{ _write(m_fd, m_buf.data() + done, static_cast<unsigned>(n > INT_MAX ? INT_MAX : n)) };
+#else
+		const ssize_t written{ ::write(m_fd, m_buf.data() + done, n) };
+#endif /* _MSC_VER */
+		if (written >= 0)
+			done += static_cast<std::size_t>(written);
+		else if (errno != EINTR)
+		{
+			m_size = 0;
+
+			throw std::runtime_error("Can't write the file descriptor.");
+		}
+	}
+
+	m_size = 0;
+}
+
+inline void Writer::flush()
+{
+	drain();
+
+	if (m_pOstr)
+		m_pOstr->flush();
+}
+
+inline Writer& Writer::put(char c)
+{
+	if (m_size == m_buf.size())
+		drain();
+
+	m_buf[m_size++] = c;
+
+	return (*this);
+}
+
+inline Writer& Writer::write(std::string_view str)
+{
+	if (str.empty())
+		return (*this);
+
+	if (str.size() > m_buf.size() - m_size)
+	{
+		drain();
+
+		// Too long to be worth copying
+		if (str.size() >= m_buf.size())
+		{
+			const std::size_t size{ m_buf.size() };
+			for (; str.size() >= size; str.remove_prefix(size))
+			{
+				std::memcpy(m_buf.data(), str.data(), size);
+				m_size = size;
+				drain();
+			}
+		}
+	}
+
+	std::memcpy(m_buf.data() + m_size, str.data(), str.size());
+	m_size += str.size();
+
+	return (*this);
+}
+
+template<typename T>
+Writer& Writer::write(T const& crVal, int precision, std::size_t width)
+{
+	if constexpr (_to_chars_v<T>)
+	{
+		char buf[_max_number];
+
+		std::to_chars_result result;
+		if constexpr (std::is_floating_point_v<T>)
+			result = (precision < 0 ? std::to_chars(buf, buf + sizeof(buf), crVal) :
+			                          std::to_chars(buf, buf + sizeof(buf), crVal, std::chars_format::general, precision ? precision : 1));
+		else
+			result = std::to_chars(buf, buf + sizeof(buf), crVal);
+
+		if (result.ec != std::errc{})
+			return write_formatted(crVal, precision, width);
+
+		const std::size_t size{ static_cast<std::size_t>(result.ptr - buf) };
+		for (; width > size; --width)
+			put(' ');
+
+		return write(std::string_view(buf, size));
+	}
+	else if constexpr (std::is_same_v<T, char>)
+	{
+		for (; width > 1; --width)
+			put(' ');
+
+		return put(crVal);
+	}
+	else if constexpr (std::is_convertible_v<T const&, std::string_view>)
+	{
+		const std::string_view str(crVal);
+		for (; width > str.size(); --width)
+			put(' ');
+
+		return write(str);
+	}
+	else
+		return write_formatted(crVal, precision, width);
+}
+
+template<typename T>
+Writer& Writer::write_formatted(T const& crVal, int precision, std::size_t width)
+{
+	std::ostringstream ss;
+	if (precision >= 0)
+		ss.precision(precision);
+
+	ss << crVal;
+	const std::string str{ ss.str() };
+	for (; width > str.size(); --width)
+		put(' ');
+
+	return write(str);
+}
+
+#endif /* __WRITER_HPP_INCLUDED__ */
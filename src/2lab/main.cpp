@@ -3,6 +3,12 @@
 
 #include "Stream.hpp"
 
+#ifdef STREAM_ASYNC
+#include <thread>
+
+#include <unistd.h>
+#endif /* STREAM_ASYNC */
+
 signed main()
 {
 	std::ios_base::sync_with_stdio(false);
@@ -23,6 +29,80 @@ signed main()
 		i.dump(std::cout);
 		std::cout << i;
 
+		Stream<int> l = { 1, 2, 3, 4, 5, 6 };
+		std::cout << l.lazy()
+		               .map([](auto&& x) { return x * x; })
+		               .where([](auto&& x) { return (x % 2 == 0); })
+		               .map([](auto&& x) { return x + 1; })
+		               .reduce([](auto&& x1, auto&& x2) { return (x1 + x2); }, 0) << std::endl;
+		l.dump(std::cout);
+		std::cout << make_memory_pipeline<int>("10 20\n30\t40").reduce([](auto&& x1, auto&& x2) { return (x1 + x2); }, 0) << std::endl;
+
+		ConcurrentStream<int> cs(64);
+		std::thread producer([&cs] { cs << "1 2 3 4 5"; cs.close(); });
+		int sum{};
+		for (int x{}; cs.pop(x); )
+			sum += x;
+		producer.join();
+		std::cout << sum << std::endl;
+
+		Stream<int> p(std::vector<int>(1 << 20, 1));
+		p.map(execution::par, [](auto&& x) { return x * 3; });
+		p.where(execution::par, [](auto&& x) { return (x % 2 == 1); });
+		std::cout << p.reduce(execution::par, [](auto&& x1, auto&& x2) { return (x1 + x2); }, 0) << std::endl;
+
+		p.affine(2, -1);
+		p.where(simd::cmp::greater, 0);
+		std::cout << p.sum() << ' ' << p.max() << ' ' << p.count(simd::cmp::equal, 5) << std::endl;
+
+		Stream<int> m1{ 1, 4, 7 }, m2{ 2, 5, 8 }, m3{ 3, 6, 9 };
+		m1.merge({ m2, m3 });
+		std::cout << m1;
+		for (auto&& part : m1.separate(2, [](auto&& x) { return (x % 2 == 0); }))
+			std::cout << part;
+
+		Stream<int> w{ 3, 1, 4, 1, 5, 9, 2, 6 };
+		std::cout << w.sliding(3, [](auto&& x1, auto&& x2) { return std::max(x1, x2); });
+		std::cout << w.tumbling(3, [](auto&& x1, auto&& x2) { return (x1 + x2); });
+		for (auto&& [key, total] : w.reduce_by_key([](auto&& x) { return (x % 2); }, [](auto&& x1, auto&& x2) { return (x1 + x2); }, 0))
+			std::cout << key << ": " << total << std::endl;
+		w.dump(std::cout, DumpLayout::flat);
+		w.write(std::cout, ',');
+
+		Stream<int, ChunkedVector<int>> chunked = std::string("5 10 15 20");
+		chunked.map([](auto&& x) { return x / 5; });
+		std::cout << chunked.sum() << std::endl;
+
+#ifdef STREAM_ASYNC
+		auto squares = [](int count) -> Generator<int>
+		{
+			for (int i{}; i < count; ++i)
+				co_yield i * i;
+		};
+		std::cout << make_generator_pipeline(squares(10)).reduce([](auto&& x1, auto&& x2) { return (x1 + x2); }, 0) << std::endl;
+
+		int fds[2];
+		if (::pipe(fds))
+			throw std::runtime_error("Can't create a pipe.");
+
+		std::thread writer([fd = fds[1]]()
+		{
+			for (int i{}; i < 100; ++i)
+			{
+				const std::string chunk{ std::to_string(i) + ' ' };
+				if (::write(fd, chunk.data(), chunk.size()) < 0)
+					break;
+			}
+
+			::close(fd);
+		});
+
+		EventLoop loop;
+		std::cout << make_async_pipeline<int>(loop, fds[0]).reduce([](auto&& x1, auto&& x2) { return (x1 + x2); }, 0) << std::endl;
+		writer.join();
+		::close(fds[0]);
+#endif /* STREAM_ASYNC */
+
 		Stream<float> f = std::string("126.8 125.8 0");
 		f.dump(std::cout);
 		f.map([](auto&& x) { return x + 0.2F; });
@@ -37,11 +117,19 @@ signed main()
 		s.dump(std::cout);
 		s.map([](auto&& x) { return x + 'x'; });
 		s.dump(std::cout);
+		auto lengths = s.map([](auto&& x) { return x.size(); });
+		lengths.dump(std::cout);
 		s.where([](auto&& x) { return (x == "aaax"); });
 		s.dump(std::cout);
 		std::cout << s.reduce([](auto&& x1, auto&& x2) { return (x1 + x2); }, "5") << std::endl;
 		s.dump(std::cout);
 		std::cout << s;
+
+		Stream<std::string_view> v;
+		v.interning() << std::string("aaa bbb aaa ccc aaa");
+		v.map([](auto&& x) { return std::string(x) + 'x'; });
+		v.where([](auto&& x) { return (x == "aaax"); });
+		std::cout << v;
 	}
 	catch (std::exception const& crException)
 	{
@@ -0,0 +1,45 @@
+// This is a personal academic project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+#include "stream_tests.hpp"
+
+#include <cstring>
+
+// Behavior checks of Stream and its building blocks.
+// Usage: 2lab_tests [name], runs every test without a name. Exit code is 0 if all checks passed.
+int main(int argc, char* argv[])
+{
+	static const struct
+	{
+		const char* cpName;
+		void (*pfnTest)();
+	} SC_TESTS[] =
+	{
+		{ "simd",           stream_tests::simd_kernels   },
+		{ "channel",        stream_tests::channel        },
+		{ "thread_pool",    stream_tests::thread_pool    },
+		{ "chunked_vector", stream_tests::chunked_vector },
+		{ "merge",          stream_tests::merge          },
+		{ "pattern",        stream_tests::pattern        },
+		{ "writer",         stream_tests::writer         }
+	};
+
+	int ran{};
+	for (auto const& crTest : SC_TESTS)
+		if (argc < 2 || !std::strcmp(argv[1], crTest.cpName))
+		{
+			const int failures{ g_failures };
+			crTest.pfnTest();
+			std::printf("%-15s %s\n", crTest.cpName, g_failures == failures ? "passed" : "FAILED");
+			++ran;
+		}
+
+	if (!ran)
+	{
+		std::fprintf(stderr, "Unknown test %s.\n", argv[1]);
+
+		return 2;
+	}
+
+	return (g_failures ? 1 : 0);
+}
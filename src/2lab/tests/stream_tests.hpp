@@ -0,0 +1,325 @@
+#pragma once
+
+#ifndef __STREAM_TESTS_HPP_INCLUDED__
+#define __STREAM_TESTS_HPP_INCLUDED__
+
+#include "../Stream.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <limits>
+#include <random>
+#include <thread>
+#include <vector>
+
+inline int g_failures{};
+
+inline void check_failed(const char* cpExpr, const char* cpFile, int line)
+{
+	std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", cpFile, line, cpExpr);
+	++g_failures;
+}
+
+#define CHECK(expr) ((expr) ? (void)0 : check_failed(#expr, __FILE__, __LINE__))
+
+namespace stream_tests
+{
+	// Sizes around every vector width, so that the SIMD bodies and the scalar tails are both covered
+	inline const std::size_t SC_SIZES[] = { 1, 3, 4, 7, 8, 15, 16, 17, 31, 32, 33, 63, 64, 65, 1000, 4099 };
+
+	template<typename T>
+	std::vector<T> random_values(std::size_t count, std::mt19937& rRng)
+	{
+		std::vector<T> ret_val(count);
+		for (auto& rVal : ret_val)
+			if constexpr (std::is_integral_v<T>)
+				rVal = static_cast<T>(rRng() % 2001) - 1000;
+			else
+				rVal = static_cast<T>(std::uniform_real_distribution<double>(-1000, 1000)(rRng));
+
+		return ret_val;
+	}
+
+	// The dispatched kernels against the plain loops of simd::scalar
+	template<typename T>
+	void simd_matches_scalar()
+	{
+		using simd::cmp;
+
+		std::mt19937 rng(sizeof(T));
+		for (std::size_t size : SC_SIZES)
+		{
+			const auto values{ random_values<T>(size, rng) };
+			const T    pivot{ values[size / 2] };
+
+			CHECK(simd::min(values.data(), size) == simd::scalar::min(values.begin() + 1, values.end(), values[0]));
+			CHECK(simd::max(values.data(), size) == simd::scalar::max(values.begin() + 1, values.end(), values[0]));
+
+			const T sum{ simd::sum(values.data(), size) }, expected{ simd::scalar::sum(values.begin(), values.end(), T{}) };
+			if constexpr (std::is_integral_v<T>)
+				CHECK(sum == expected);
+			else
+				CHECK(std::fabs(sum - expected) <= 1000 * size * size * std::numeric_limits<T>::epsilon());
+
+			for (cmp op : { cmp::less, cmp::less_equal, cmp::greater, cmp::greater_equal, cmp::equal, cmp::not_equal })
+			{
+				CHECK(simd::count(values.data(), size, op, pivot) ==
+				      simd::detail::with_cmp(op, [&](auto op_tag) { return simd::scalar::count<decltype(op_tag)::value>(values.begin(), values.end(), pivot); }));
+
+				std::vector<T> kept(size), expected_kept;
+				kept.resize(simd::filter(values.data(), size, kept.data(), op, pivot));
+				std::copy_if(values.begin(), values.end(), std::back_inserter(expected_kept), [&](T val) { return simd::compare(op, val, pivot); });
+				CHECK(kept == expected_kept);
+			}
+
+			auto affine{ values }, expected_affine{ values };
+			simd::affine(affine.data(), size, T(3), T(-7));
+			simd::scalar::affine(expected_affine.begin(), expected_affine.end(), T(3), T(-7));
+			CHECK(affine == expected_affine);
+		}
+	}
+
+	// NaN is skipped by every path, whatever lane or segment it lands in
+	template<typename T>
+	void min_max_skip_nan()
+	{
+		const T nan{ std::numeric_limits<T>::quiet_NaN() };
+
+		std::vector<T> values(40, T(1));
+		values[3]  = -5;
+		values[16] = nan;
+		values[20] = 9;
+
+		const Stream<T>                contiguous{ std::vector<T>(values) };
+		const Stream<T, std::deque<T>> sequential{ std::deque<T>(values.begin(), values.end()) };
+		CHECK(contiguous.min() == -5 && sequential.min() == -5);
+		CHECK(contiguous.max() == 9 && sequential.max() == 9);
+
+		values[0] = nan;
+		CHECK(simd::min(values.data(), values.size()) == -5 && simd::max(values.data(), values.size()) == 9);
+		CHECK(Stream<T>{ std::vector<T>(values) }.min() == -5);
+
+		const std::vector<T> nans(33, nan);
+		CHECK(std::isnan(simd::min(nans.data(), nans.size())) && std::isnan(simd::max(nans.data(), nans.size())));
+	}
+
+	inline void simd_kernels()
+	{
+		simd_matches_scalar<int>();
+		simd_matches_scalar<float>();
+		simd_matches_scalar<double>();
+
+		min_max_skip_nan<float>();
+		min_max_skip_nan<double>();
+	}
+
+	// Every push that reports success has to be popped, however it races close()
+	template<typename Ring>
+	void channel_close_race(int nProducers, int nConsumers)
+	{
+		for (int iteration{}; iteration < 300; ++iteration)
+		{
+			Channel<int, Ring>       channel(8);
+			std::atomic<long>        accepted(0), received(0);
+			std::vector<std::thread> threads;
+			for (int i{}; i < nProducers; ++i)
+				threads.emplace_back([&]
+				{
+					for (int j{}; j < 200; ++j)
+					{
+						int val{ j };
+						if ((j & 1) ? channel.push(val) : channel.try_push(val))
+							++accepted;
+					}
+				});
+
+			for (int i{}; i < nConsumers; ++i)
+				threads.emplace_back([&]
+				{
+					int buf[4];
+					while (const std::size_t n{ channel.pop_n(buf, 4) })
+						received += static_cast<long>(n);
+				});
+
+			std::this_thread::yield();
+			channel.close();
+			for (auto& rThread : threads)
+				rThread.join();
+
+			CHECK(accepted == received);
+		}
+	}
+
+	inline void channel()
+	{
+		Channel<int, SpscRing<int>> spsc(4);
+		std::thread producer([&] { for (int i{}; i < 10000; ++i) spsc.push(i); spsc.close(); });
+
+		int  val{}, expected{};
+		bool ordered{ true };
+		while (spsc.pop(val))
+			ordered &= (val == expected++);
+
+		producer.join();
+		CHECK(ordered && expected == 10000);
+
+		channel_close_race<MpmcRing<int>>(3, 2);
+		channel_close_race<SpscRing<int>>(1, 1);
+
+		// Elements that don't make it into a closed channel stay in the stream
+		ConcurrentStream<int> concurrent(4);
+		Stream<int>           stream{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+		std::thread           consumer([&] { int x; for (int i{}; i < 3; ++i) concurrent >> x; concurrent.close(); });
+
+		bool threw{};
+		try
+		{
+			concurrent << stream;
+		}
+		catch (std::runtime_error const&)
+		{
+			threw = true;
+		}
+
+		consumer.join();
+
+		std::size_t left{};
+		for (int x; concurrent.pop(x); )
+			++left;
+
+		CHECK(threw && stream.size() + left + 3 == 10);
+	}
+
+	inline void thread_pool()
+	{
+		ThreadPool pool(4);
+
+		std::vector<std::atomic<int>> hits(1000);
+		pool.parallel_for(hits.size(), [&](std::size_t i) { ++hits[i]; });
+		CHECK(std::all_of(hits.begin(), hits.end(), [](auto const& crHits) { return crHits == 1; }));
+
+		// Nested calls run on the waiting threads instead of deadlocking
+		std::atomic<int> nested(0);
+		pool.parallel_for(8, [&](std::size_t) { pool.parallel_for(8, [&](std::size_t) { ++nested; }); });
+		CHECK(nested == 64);
+
+		bool threw{};
+		try
+		{
+			pool.parallel_for(16, [](std::size_t i) { if (i == 5) throw std::logic_error("5"); });
+		}
+		catch (std::logic_error const&)
+		{
+			threw = true;
+		}
+
+		CHECK(threw);
+	}
+
+	// Random operations against std::deque
+	inline void chunked_vector()
+	{
+		std::mt19937        rng(3);
+		ChunkedVector<long> vec;
+		std::deque<long>    model;
+		bool                equal{ true };
+		for (long i{}; i < 300000 && equal; ++i)
+		{
+			const auto op{ rng() % 100 };
+			if (op < 55)
+			{
+				vec.push_back(i);
+				model.push_back(i);
+			}
+			else if (op < 85 && !model.empty())
+			{
+				vec.pop_front();
+				model.pop_front();
+			}
+			else if (op < 90 && !model.empty())
+			{
+				vec.pop_back();
+				model.pop_back();
+			}
+			else if (op < 92 && !model.empty())
+			{
+				const auto count{ static_cast<std::ptrdiff_t>(rng() % model.size()) };
+				vec.erase(vec.begin(), vec.begin() + count);
+				model.erase(model.begin(), model.begin() + count);
+			}
+			else if (op < 93)
+				vec.reserve(model.size() + rng() % 5000);
+			else if (op < 94)
+				vec.shrink_to_fit();
+
+			equal = (vec.size() == model.size() && (model.empty() || (vec.front() == model.front() && vec.back() == model.back() &&
+			                                                          vec[model.size() / 2] == model[model.size() / 2])));
+		}
+
+		CHECK(equal);
+
+		const ChunkedVector<long> copy(vec);
+		CHECK(std::equal(copy.begin(), copy.end(), model.begin(), model.end()));
+	}
+
+	inline void merge()
+	{
+		std::mt19937 rng(7);
+		for (std::size_t size : { 10, 1000, 200000 })
+		{
+			std::vector<Stream<int>> streams(5);
+			std::vector<int>         expected;
+			for (auto& rStream : streams)
+			{
+				auto values{ random_values<int>(size, rng) };
+				std::sort(values.begin(), values.end());
+				expected.insert(expected.end(), values.begin(), values.end());
+				rStream = Stream<int>(std::move(values));
+			}
+
+			std::sort(expected.begin(), expected.end());
+
+			std::vector<std::reference_wrapper<Stream<int>>> others(streams.begin() + 1, streams.end());
+			streams[0].merge(execution::par, others);
+			CHECK(std::equal(streams[0].begin(), streams[0].end(), expected.begin(), expected.end()));
+			CHECK(std::all_of(others.begin(), others.end(), [](auto const& crStream) { return crStream.get().empty(); }));
+		}
+	}
+
+	// Overlapping matches, and string values that outlive the text they were parsed from
+	inline void pattern()
+	{
+		const Pattern<int> ints("1 2 1");
+		const std::vector  values{ 1, 2, 1, 2, 1, 3, 1, 2, 1 };
+		CHECK((ints.find_all(values.begin(), values.end()) == std::vector<std::size_t>{ 0, 2, 6 }));
+
+		auto pText{ std::make_unique<std::string>("ab cd ab") };
+		const Pattern<std::string_view> words(*pText);
+		pText->assign(pText->size(), '#');
+		pText.reset();
+
+		const std::vector<std::string_view> tokens{ "ab", "cd", "ab", "cd", "ab" };
+		CHECK(words.count(tokens.begin(), tokens.end()) == 2);
+	}
+
+	// Precisions above what the writer formats in place go through the ostream
+	inline void writer()
+	{
+		for (int precision : { 1, 6, 17, 56, 57, 80 })
+		{
+			std::ostringstream direct, expected;
+			{
+				Writer writer(direct);
+				writer.write(0.1, precision).put(' ').write(1e300, precision);
+			}
+
+			expected << std::setprecision(precision) << 0.1 << ' ' << 1e300;
+			CHECK(direct.str() == expected.str());
+		}
+	}
+} // namespace stream_tests
+
+#endif /* __STREAM_TESTS_HPP_INCLUDED__ */